@@ -0,0 +1,107 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Training steps through a rectified hidden layer at several output densities: dense outputs vs.
+ * compacted outputs, which the next layer skips.
+ *
+ * Usage: benchmark_activation_sparse [units] [repetitions]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/neuron/rectified_linear.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>;
+using Output = ffnn::layer::Output<float>;
+
+/// Runs training steps with a fraction <code>density</code> of active units
+double run(int units, double density, int repetitions, double max_density)
+{
+  static const int INPUTS = 64;
+
+  auto input = boost::make_shared<Input>(INPUTS);
+  auto hidden1 = boost::make_shared<Hidden>(units);
+  auto activation = boost::make_shared<Activation>();
+  auto hidden2 = boost::make_shared<Hidden>(units);
+  auto output = boost::make_shared<Output>();
+  hidden1->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(1e-6));
+  hidden2->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(1e-6));
+  activation->setSparseOutputs(max_density);
+
+  std::vector<Layer::Ptr> layers({input, hidden1, activation, hidden2, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+  }
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  // Biases select active units
+  Eigen::VectorXf biases(units);
+  for (int idx = 0; idx < units; idx++)
+  {
+    biases(idx) = (std::rand() < density * RAND_MAX) ? 1.0f : -1.0f;
+  }
+  hidden1->setParameters(1e-3f * Eigen::MatrixXf::Random(units, INPUTS), biases);
+
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(INPUTS);
+  const Eigen::VectorXf target = Eigen::VectorXf::Zero(units);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < repetitions; rep++)
+  {
+    (*input) << x;
+    for(const auto& layer : layers)
+    {
+      layer->forward();
+    }
+    (*output) << target;
+    for(const auto& layer : layers)
+    {
+      layer->backward();
+    }
+    for(const auto& layer : layers)
+    {
+      layer->update();
+    }
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count() / repetitions;
+}
+
+int main(int argc, char** argv)
+{
+  const int units = (argc > 1) ? std::atoi(argv[1]) : 1024;
+  const int repetitions = (argc > 2) ? std::atoi(argv[2]) : 200;
+
+  const double densities[] = {0.05, 0.1, 0.25, 0.5, 0.75, 0.9};
+  for (const double density : densities)
+  {
+    const double dense = run(units, density, repetitions, 0.0);
+    const double sparse = run(units, density, repetitions, 1.0);
+    std::cout << "units=" << units
+              << "\tdensity=" << density
+              << "\tdense[us]=" << 1e6 * dense
+              << "\tsparse[us]=" << 1e6 * sparse
+              << "\tspeedup=" << dense / sparse << std::endl;
+  }
+  return 0;
+}
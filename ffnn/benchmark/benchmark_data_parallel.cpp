@@ -0,0 +1,108 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Training throughput of DataParallel with 1..N replicas.
+ *
+ * Usage: benchmark_data_parallel [replicas] [batch-size] [steps]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/data_parallel.h>
+#include <ffnn/neuron/rectified_linear.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+int main(int argc, char** argv)
+{
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Activation = ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>;
+  using Output = ffnn::layer::Output<float>;
+  using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+  using Trainer = ffnn::network::DataParallel<float>;
+
+  const int max_replicas = (argc > 1) ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+  const int batch = (argc > 2) ? std::atoi(argv[2]) : 256;
+  const int steps = (argc > 3) ? std::atoi(argv[3]) : 20;
+
+  const Eigen::MatrixXf inputs = Eigen::MatrixXf::Random(256, batch);
+  const Eigen::MatrixXf targets = Eigen::MatrixXf::Random(16, batch);
+  const Trainer::SampleLoader load_inputs = [&inputs](const Trainer::LayerSequence& layers, Trainer::SizeType sdx)
+  {
+    (*boost::static_pointer_cast<Input>(layers.front())) << inputs.col(sdx);
+    return true;
+  };
+  const Trainer::SampleLoader load_targets = [&targets](const Trainer::LayerSequence& layers, Trainer::SizeType sdx)
+  {
+    (*boost::static_pointer_cast<Output>(layers.back())) << targets.col(sdx);
+    return true;
+  };
+
+  double single_replica_rate = 0;
+  for (int replica_count = 1; replica_count <= max_replicas; replica_count *= 2)
+  {
+    // Create replicas
+    std::vector<Trainer::LayerSequence> replicas;
+    for (int rdx = 0; rdx < replica_count; rdx++)
+    {
+      Trainer::LayerSequence layers({boost::make_shared<Input>(256),
+                                     boost::make_shared<Hidden>(512),
+                                     boost::make_shared<Activation>(),
+                                     boost::make_shared<Hidden>(512),
+                                     boost::make_shared<Activation>(),
+                                     boost::make_shared<Hidden>(16),
+                                     boost::make_shared<Output>()});
+      for (size_t idx = 1UL; idx < layers.size(); idx++)
+      {
+        ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+      }
+      for (size_t idx = 1UL; idx < layers.size(); idx += 2)
+      {
+        boost::static_pointer_cast<Hidden>(layers[idx])->setOptimizer(boost::make_shared<Optimizer>(1e-3));
+      }
+      for(const auto& layer : layers)
+      {
+        layer->initialize();
+      }
+      replicas.push_back(layers);
+    }
+
+    Trainer trainer;
+    if (!trainer.setup(replicas))
+    {
+      return 1;
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int itr = 0; itr < steps; itr++)
+    {
+      trainer.step(batch, load_inputs, load_targets);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double rate = (steps * batch) / std::chrono::duration<double>(t1 - t0).count();
+    if (replica_count == 1)
+    {
+      single_replica_rate = rate;
+    }
+    std::cout << "replicas=" << replica_count
+              << "\tsamples/s=" << rate
+              << "\tspeedup=" << rate / single_replica_rate << std::endl;
+  }
+  return 0;
+}
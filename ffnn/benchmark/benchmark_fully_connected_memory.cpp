@@ -0,0 +1,199 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Forward-pass latency and data-TLB misses of a large FullyConnected layer
+ * for each memory resource.
+ *
+ * Usage: benchmark_fully_connected_memory [dimension] [iterations]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Linux
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/memory/arena_resource.h>
+#include <ffnn/memory/page_resource.h>
+#include <ffnn/memory/resource.h>
+
+namespace
+{
+/**
+ * @brief Counts data-TLB load misses of the calling thread, if perf events are available
+ */
+class TLBMissCounter
+{
+public:
+  TLBMissCounter() :
+    fd_(-1)
+  {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+
+  ~TLBMissCounter()
+  {
+#if defined(__linux__)
+    if (fd_ >= 0)
+    {
+      ::close(fd_);
+    }
+#endif
+  }
+
+  bool available() const
+  {
+    return fd_ >= 0;
+  }
+
+  void start()
+  {
+#if defined(__linux__)
+    if (available())
+    {
+      ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  long long stop()
+  {
+    long long count = -1;
+#if defined(__linux__)
+    if (available())
+    {
+      ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+      if (::read(fd_, &count, sizeof(count)) != sizeof(count))
+      {
+        count = -1;
+      }
+    }
+#endif
+    return count;
+  }
+
+private:
+  int fd_;
+};
+
+/**
+ * @brief Builds a network in <code>resource</code> and times forward passes
+ */
+void run(const std::string& name, ffnn::memory::Resource* resource, int dim, int iterations)
+{
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Output = ffnn::layer::Output<float>;
+
+  ffnn::memory::ScopedResource scope(resource);
+
+  auto input = boost::make_shared<Input>(dim);
+  auto hidden = boost::make_shared<Hidden>(dim);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input, hidden, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+  }
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  Hidden::InputVector input_data = Hidden::InputVector::Random(dim);
+  Hidden::OutputVector output_data(dim);
+
+  // Warm up (faults in all pages)
+  (*input) << input_data;
+  for(const auto& layer : layers)
+  {
+    layer->forward();
+  }
+
+  TLBMissCounter tlb;
+  tlb.start();
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int itr = 0; itr < iterations; itr++)
+  {
+    (*input) << input_data;
+    for(const auto& layer : layers)
+    {
+      layer->forward();
+    }
+    (*output) >> output_data;
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  const long long misses = tlb.stop();
+
+  const double us = std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations;
+  std::cout << name << "\tlatency(us)=" << us << "\tdTLB-misses/pass=";
+  if (misses < 0)
+  {
+    std::cout << "n/a";
+  }
+  else
+  {
+    std::cout << static_cast<double>(misses) / iterations;
+  }
+  std::cout << std::endl;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const int dim = (argc > 1) ? std::atoi(argv[1]) : 4096;
+  const int iterations = (argc > 2) ? std::atoi(argv[2]) : 100;
+
+  std::cout << "FullyConnected " << dim << "x" << dim << ", " << iterations << " passes" << std::endl;
+
+  run("heap", ffnn::memory::heapResource(), dim, iterations);
+  {
+    ffnn::memory::ArenaResource arena(64UL << 20);
+    run("arena", &arena, dim, iterations);
+  }
+  {
+    ffnn::memory::PageResource pages(ffnn::memory::PageResource::HugePages::None);
+    run("pages", &pages, dim, iterations);
+  }
+  {
+    ffnn::memory::PageResource pages(ffnn::memory::PageResource::HugePages::Transparent);
+    run("thp", &pages, dim, iterations);
+  }
+  {
+    ffnn::memory::PageResource pages(ffnn::memory::PageResource::HugePages::Explicit);
+    run("hugetlb", &pages, dim, iterations);
+  }
+  return 0;
+}
@@ -0,0 +1,181 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Convergence and throughput of asynchronous (Hogwild) training against synchronous
+ * (DataParallel) training, on a sparse, high-dimensional regression problem, with 1..N threads.
+ *
+ * Usage: benchmark_hogwild [threads] [epochs] [samples]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/layer/sparsely_connected.h>
+#include <ffnn/network/data_parallel.h>
+#include <ffnn/network/hogwild.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Sparse = ffnn::layer::SparselyConnected<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Output = ffnn::layer::Output<float>;
+using LayerSequence = std::vector<Layer::Ptr>;
+
+static const int INPUTS = 4096;
+static const int OUTPUTS = 8;
+static const int ACTIVE = 16;
+static const int BATCH = 32;
+
+/**
+ * @brief Creates identically seeded network replicas
+ */
+std::vector<LayerSequence> createReplicas(int count, float lr)
+{
+  std::vector<LayerSequence> replicas;
+  for (int rdx = 0; rdx < count; rdx++)
+  {
+    auto sparse = boost::make_shared<Sparse>(64, Sparse::Parameters(0.1, 0.1, 0.1));
+    auto hidden = boost::make_shared<Hidden>(OUTPUTS, Hidden::Parameters(0.1, 0.1));
+    sparse->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Sparse>>(lr));
+    hidden->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(lr));
+
+    LayerSequence layers({boost::make_shared<Input>(INPUTS), sparse, hidden, boost::make_shared<Output>()});
+    for (size_t idx = 1UL; idx < layers.size(); idx++)
+    {
+      ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+    }
+    std::srand(rdx + 1);
+    for(const auto& layer : layers)
+    {
+      layer->initialize();
+    }
+    replicas.push_back(layers);
+  }
+  return replicas;
+}
+
+int main(int argc, char** argv)
+{
+  const int max_threads = (argc > 1) ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+  const int epochs = (argc > 2) ? std::atoi(argv[2]) : 5;
+  const int samples = (argc > 3) ? std::atoi(argv[3]) : 20000;
+
+  // Sparse inputs (few active features) and targets from a linear teacher
+  std::srand(0);
+  const Eigen::MatrixXf teacher = 0.05f * Eigen::MatrixXf::Random(OUTPUTS, INPUTS);
+  std::vector<std::vector<int>> features(samples);
+  Eigen::MatrixXf targets = Eigen::MatrixXf::Zero(OUTPUTS, samples);
+  for (int sdx = 0; sdx < samples; sdx++)
+  {
+    for (int kdx = 0; kdx < ACTIVE; kdx++)
+    {
+      features[sdx].push_back(std::rand() % INPUTS);
+      targets.col(sdx) += teacher.col(features[sdx].back());
+    }
+  }
+
+  const std::function<bool(const LayerSequence&, FFNN_SIZE_TYPE)> load_inputs =
+    [&features](const LayerSequence& layers, FFNN_SIZE_TYPE sdx)
+    {
+      Eigen::VectorXf input = Eigen::VectorXf::Zero(INPUTS);
+      for (const int fdx : features[sdx])
+      {
+        input(fdx) += 1.0f;
+      }
+      (*boost::static_pointer_cast<Input>(layers.front())) << input;
+      return true;
+    };
+  const std::function<bool(const LayerSequence&, FFNN_SIZE_TYPE)> load_targets =
+    [&targets](const LayerSequence& layers, FFNN_SIZE_TYPE sdx)
+    {
+      (*boost::static_pointer_cast<Output>(layers.back())) << targets.col(sdx);
+      return true;
+    };
+
+  // Mean error over all samples with the shared parameters
+  const auto error = [&](const LayerSequence& layers)
+  {
+    double total = 0;
+    Eigen::VectorXf result(OUTPUTS);
+    for (int sdx = 0; sdx < samples; sdx++)
+    {
+      load_inputs(layers, sdx);
+      for(const auto& layer : layers)
+      {
+        layer->forward();
+      }
+      (*boost::static_pointer_cast<Output>(layers.back())) >> result;
+      total += (result - targets.col(sdx)).norm();
+    }
+    return total / samples;
+  };
+
+  std::cout << "mode=init\terror=" << error(createReplicas(1, 0).front()) << std::endl;
+  for (int threads = 1; threads <= max_threads; threads *= 2)
+  {
+    // Synchronous: one update per BATCH samples, gradients summed over all threads
+    {
+      const auto replicas = createReplicas(threads, 2e-2 / BATCH);
+      ffnn::network::DataParallel<float> trainer;
+      if (!trainer.setup(replicas))
+      {
+        return 1;
+      }
+      const auto t0 = std::chrono::steady_clock::now();
+      for (int epoch = 0; epoch < epochs; epoch++)
+      {
+        for (int first = 0; first < samples; first += BATCH)
+        {
+          const int count = std::min(BATCH, samples - first);
+          const auto offset_inputs = [&load_inputs, first](const LayerSequence& layers, FFNN_SIZE_TYPE sdx)
+          {
+            return load_inputs(layers, first + sdx);
+          };
+          const auto offset_targets = [&load_targets, first](const LayerSequence& layers, FFNN_SIZE_TYPE sdx)
+          {
+            return load_targets(layers, first + sdx);
+          };
+          trainer.step(count, offset_inputs, offset_targets);
+        }
+      }
+      const auto t1 = std::chrono::steady_clock::now();
+      std::cout << "mode=sync\tthreads=" << threads
+                << "\tsamples/s=" << (epochs * samples) / std::chrono::duration<double>(t1 - t0).count()
+                << "\terror=" << error(replicas.front()) << std::endl;
+    }
+
+    // Asynchronous: one update per thread per sample
+    {
+      const auto replicas = createReplicas(threads, 2e-2);
+      ffnn::network::Hogwild<float> trainer;
+      if (!trainer.setup(replicas))
+      {
+        return 1;
+      }
+      const auto t0 = std::chrono::steady_clock::now();
+      for (int epoch = 0; epoch < epochs; epoch++)
+      {
+        trainer.run(samples, load_inputs, load_targets);
+      }
+      const auto t1 = std::chrono::steady_clock::now();
+      std::cout << "mode=hogwild\tthreads=" << threads
+                << "\tsamples/s=" << (epochs * samples) / std::chrono::duration<double>(t1 - t0).count()
+                << "\terror=" << error(replicas.front()) << std::endl;
+    }
+  }
+  return 0;
+}
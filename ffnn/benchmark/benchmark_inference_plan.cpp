@@ -0,0 +1,97 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Inference throughput of one shared InferencePlan with 1..N request threads.
+ *
+ * Usage: benchmark_inference_plan [threads] [samples-per-thread]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/neuron/rectified_linear.h>
+
+int main(int argc, char** argv)
+{
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Activation = ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>;
+  using Output = ffnn::layer::Output<float>;
+  using Plan = ffnn::network::InferencePlan<float>;
+
+  const int max_threads = (argc > 1) ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+  const int samples = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+  // Create network
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(256),
+                                  boost::make_shared<Hidden>(512),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(512),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(16),
+                                  boost::make_shared<Output>()});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+  }
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  Plan plan;
+  if (!plan.compile(layers))
+  {
+    return 1;
+  }
+
+  double single_thread_rate = 0;
+  for (int threads = 1; threads <= max_threads; threads *= 2)
+  {
+    std::vector<std::thread> workers;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int tdx = 0; tdx < threads; tdx++)
+    {
+      workers.emplace_back([&plan, samples]()
+      {
+        Plan::Workspace workspace = plan.createWorkspace();
+        Eigen::VectorXf input = Eigen::VectorXf::Random(256);
+        Eigen::VectorXf output(16);
+        for (int itr = 0; itr < samples; itr++)
+        {
+          plan.forward(input, output, workspace);
+        }
+      });
+    }
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double rate = (threads * samples) / std::chrono::duration<double>(t1 - t0).count();
+    if (threads == 1)
+    {
+      single_thread_rate = rate;
+    }
+    std::cout << "threads=" << threads
+              << "\tsamples/s=" << rate
+              << "\tspeedup=" << rate / single_thread_rate << std::endl;
+  }
+  return 0;
+}
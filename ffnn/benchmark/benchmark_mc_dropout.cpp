@@ -0,0 +1,106 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Monte Carlo dropout: T single-sample passes vs. one batched pass over T replicas.
+ *
+ * Usage: benchmark_mc_dropout [samples] [repetitions]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/neuron/modifier/inverted_dropout.h>
+#include <ffnn/neuron/rectified_linear.h>
+
+/// Rectified linear neuron with 20% inverted dropout
+template<typename ValueType>
+using RectifiedLinearDropout =
+  ffnn::neuron::modifier::InvertedDropout<ValueType, ffnn::neuron::RectifiedLinear, 20>;
+
+int main(int argc, char** argv)
+{
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Activation = ffnn::layer::Activation<float, RectifiedLinearDropout>;
+  using Output = ffnn::layer::Output<float>;
+  using Plan = ffnn::network::InferencePlan<float>;
+
+  const int samples = (argc > 1) ? std::atoi(argv[1]) : 64;
+  const int repetitions = (argc > 2) ? std::atoi(argv[2]) : 50;
+
+  // Create network
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(256),
+                                  boost::make_shared<Hidden>(512),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(512),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(16),
+                                  boost::make_shared<Output>()});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+  }
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  Plan plan;
+  if (!plan.compile(layers))
+  {
+    return 1;
+  }
+
+  const Eigen::VectorXf input = Eigen::VectorXf::Random(256);
+  Eigen::VectorXf mean(16), variance(16);
+  std::uint32_t pass = 0;
+
+  // One pass per sample
+  Plan::Workspace single = plan.createWorkspace(1);
+  Eigen::MatrixXf outputs(16, samples);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < repetitions; rep++)
+  {
+    for (int col = 0; col < samples; col++)
+    {
+      float* output[1] = {outputs.col(col).data()};
+      const float* in[1] = {input.data()};
+      plan.sample(in, output, 1, single, pass++);
+    }
+    mean = outputs.rowwise().mean();
+    variance = (outputs.colwise() - mean).array().square().rowwise().mean();
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+
+  // One batched pass
+  Plan::Workspace batched = plan.createWorkspace(samples);
+  const auto t2 = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < repetitions; rep++)
+  {
+    plan.sample(input, samples, mean, variance, batched, pass++);
+  }
+  const auto t3 = std::chrono::steady_clock::now();
+
+  const double sequential = std::chrono::duration<double>(t1 - t0).count() / repetitions;
+  const double batch = std::chrono::duration<double>(t3 - t2).count() / repetitions;
+  std::cout << "samples=" << samples
+            << "\tsequential[ms]=" << 1e3 * sequential
+            << "\tbatched[ms]=" << 1e3 * batch
+            << "\tspeedup=" << sequential / batch << std::endl;
+  return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Single-sample latency of a multi-tower network, with towers evaluated sequentially
+ * and concurrently on a WorkStealingPool.
+ *
+ * Usage: benchmark_parallel_branches [towers] [samples]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/neuron/rectified_linear.h>
+#include <ffnn/thread/work_stealing_pool.h>
+
+int main(int argc, char** argv)
+{
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Activation = ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>;
+  using Output = ffnn::layer::Output<float>;
+  using Plan = ffnn::network::InferencePlan<float>;
+  using Pool = ffnn::thread::WorkStealingPool;
+
+  static const int INPUTS = 128;
+  static const int WIDTH = 512;
+
+  const int towers = (argc > 1) ? std::atoi(argv[1]) : 4;
+  const int samples = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+  // Create network; each tower has its own input, and one layer concatenates all towers
+  std::vector<Layer::Ptr> layers;
+  std::vector<Layer::Ptr> ends;
+  for (int tdx = 0; tdx < towers; tdx++)
+  {
+    std::vector<Layer::Ptr> tower({boost::make_shared<Input>(INPUTS),
+                                   boost::make_shared<Hidden>(WIDTH),
+                                   boost::make_shared<Activation>(),
+                                   boost::make_shared<Hidden>(WIDTH),
+                                   boost::make_shared<Activation>()});
+    for (size_t idx = 1UL; idx < tower.size(); idx++)
+    {
+      ffnn::layer::connect<Layer>(tower[idx-1UL], tower[idx]);
+    }
+    layers.insert(layers.end(), tower.begin(), tower.end());
+    ends.push_back(tower.back());
+  }
+  auto merge = boost::make_shared<Hidden>(16);
+  for (const auto& end : ends)
+  {
+    ffnn::layer::connect<Layer>(end, merge);
+  }
+  layers.push_back(merge);
+  layers.push_back(boost::make_shared<Output>());
+  ffnn::layer::connect<Layer>(merge, layers.back());
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  Plan plan;
+  if (!plan.compile(layers))
+  {
+    return 1;
+  }
+
+  std::vector<Eigen::VectorXf> input_data(towers, Eigen::VectorXf::Random(INPUTS));
+  std::vector<const float*> inputs;
+  for (const auto& data : input_data)
+  {
+    inputs.push_back(data.data());
+  }
+  Eigen::VectorXf result(16);
+  float* outputs[1] = {result.data()};
+
+  Plan::Workspace workspace = plan.createWorkspace();
+  Pool pool(Pool::defaultWorkers());
+
+  // Sequential
+  auto t0 = std::chrono::steady_clock::now();
+  for (int itr = 0; itr < samples; itr++)
+  {
+    plan.forward(inputs.data(), outputs, 1, workspace);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  const double sequential = std::chrono::duration<double, std::micro>(t1 - t0).count() / samples;
+
+  // Parallel branches
+  t0 = std::chrono::steady_clock::now();
+  for (int itr = 0; itr < samples; itr++)
+  {
+    plan.forward(inputs.data(), outputs, 1, workspace, pool);
+  }
+  t1 = std::chrono::steady_clock::now();
+  const double parallel = std::chrono::duration<double, std::micro>(t1 - t0).count() / samples;
+
+  std::cout << "towers=" << towers << "\tworkers=" << pool.size() << std::endl;
+  std::cout << "sequential\tus/sample=" << sequential << std::endl;
+  std::cout << "parallel\tus/sample=" << parallel << "\tspeedup=" << sequential / parallel << std::endl;
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Streaming inference throughput of a Pipeline with 1..N stages, over a deep chain of large
+ * layers, against a single-threaded InferencePlan.
+ *
+ * Usage: benchmark_pipeline [stages] [samples]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/fully_connected_activation.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/network/pipeline.h>
+#include <ffnn/neuron/rectified_linear.h>
+
+int main(int argc, char** argv)
+{
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnectedActivation<float, ffnn::neuron::RectifiedLinear>;
+  using Output = ffnn::layer::Output<float>;
+  using Plan = ffnn::network::InferencePlan<float>;
+  using Pipeline = ffnn::network::Pipeline<float>;
+
+  const int max_stages = (argc > 1) ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+  const int samples = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+  // Create network (deep chain of large layers)
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(1024)});
+  for (int idx = 0; idx < 8; idx++)
+  {
+    layers.push_back(boost::make_shared<Hidden>(1024));
+  }
+  layers.push_back(boost::make_shared<Output>());
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+  }
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  const Eigen::VectorXf input = Eigen::VectorXf::Random(1024);
+  Eigen::VectorXf output(1024);
+
+  // Single-threaded reference
+  double plan_rate = 0;
+  {
+    Plan plan;
+    if (!plan.compile(layers))
+    {
+      return 1;
+    }
+    Plan::Workspace workspace = plan.createWorkspace();
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int itr = 0; itr < samples; itr++)
+    {
+      plan.forward(input, output, workspace);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    plan_rate = samples / std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "plan\tsamples/s=" << plan_rate << std::endl;
+  }
+
+  for (int stages = 1; stages <= max_stages; stages *= 2)
+  {
+    const Pipeline::Parameters config(stages);
+    Pipeline pipeline(config);
+    if (!pipeline.compile(layers))
+    {
+      return 1;
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    std::thread producer([&pipeline, &input, samples]()
+    {
+      for (int itr = 0; itr < samples; itr++)
+      {
+        pipeline.push(input.data(), 1);
+      }
+    });
+    for (int itr = 0; itr < samples; itr++)
+    {
+      pipeline.pop(output.data());
+    }
+    producer.join();
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double rate = samples / std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "stages=" << pipeline.stageCount()
+              << "\tsamples/s=" << rate
+              << "\tspeedup=" << rate / plan_rate << std::endl;
+  }
+  return 0;
+}
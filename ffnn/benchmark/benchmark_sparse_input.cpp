@@ -0,0 +1,107 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ *
+ * Training steps over wide, mostly-zero inputs: dense inputs vs. sparse inputs.
+ *
+ * Usage: benchmark_sparse_input [inputs] [nnz] [repetitions]
+ */
+// C++ Standard Library
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Output = ffnn::layer::Output<float>;
+
+/// Runs training steps; inputs are set sparsely if <code>sparse</code> is true
+double run(int inputs, const std::vector<Eigen::SparseVector<float>>& data, int repetitions, bool sparse)
+{
+  auto input = boost::make_shared<Input>(inputs);
+  auto hidden = boost::make_shared<Hidden>(64);
+  auto output = boost::make_shared<Output>();
+  hidden->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(1e-3));
+
+  std::vector<Layer::Ptr> layers({input, hidden, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]);
+  }
+  for(const auto& layer : layers)
+  {
+    layer->initialize();
+  }
+
+  Eigen::VectorXf dense(inputs);
+  const Eigen::VectorXf target = Eigen::VectorXf::Zero(64);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < repetitions; rep++)
+  {
+    for (const auto& x : data)
+    {
+      if (sparse)
+      {
+        (*input) << x;
+      }
+      else
+      {
+        dense = x;
+        (*input) << dense;
+      }
+      for(const auto& layer : layers)
+      {
+        layer->forward();
+      }
+      (*output) << target;
+      for(const auto& layer : layers)
+      {
+        layer->backward();
+      }
+      for(const auto& layer : layers)
+      {
+        layer->update();
+      }
+    }
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count() / (repetitions * data.size());
+}
+
+int main(int argc, char** argv)
+{
+  const int inputs = (argc > 1) ? std::atoi(argv[1]) : 16384;
+  const int nnz = (argc > 2) ? std::atoi(argv[2]) : 32;
+  const int repetitions = (argc > 3) ? std::atoi(argv[3]) : 4;
+
+  // Random sparse inputs
+  std::vector<Eigen::SparseVector<float>> data(64, Eigen::SparseVector<float>(inputs));
+  for (auto& x : data)
+  {
+    for (int k = 0; k < nnz; k++)
+    {
+      x.coeffRef(std::rand() % inputs) = 1.0f;
+    }
+  }
+
+  const double dense = run(inputs, data, repetitions, false);
+  const double sparse = run(inputs, data, repetitions, true);
+  std::cout << "inputs=" << inputs
+            << "\tnnz=" << nnz
+            << "\tdense[us]=" << 1e6 * dense
+            << "\tsparse[us]=" << 1e6 * sparse
+            << "\tspeedup=" << dense / sparse << std::endl;
+  return 0;
+}
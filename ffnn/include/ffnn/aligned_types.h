@@ -6,99 +6,185 @@
 #define FFNN_ALIGNED_TYPES_H
 
 // C++ Standard Library
+#include <cstdint>
+#include <new>
+#include <type_traits>
 #include <vector>
 
-// Boost
-#include <boost/make_shared.hpp>
-#include <boost/shared_ptr.hpp>
-
 // FFNN
 #include <ffnn/config/global.h>
+#include <ffnn/assert.h>
+#include <ffnn/memory/resource.h>
 
 namespace ffnn
 {
 namespace aligned
 {
-template<typename ValueType>
-struct Buffer :
-  public std::vector<ValueType, Eigen::aligned_allocator<ValueType>>
+/// Byte alignment of all network buffers and buffer segments
+static constexpr int Alignment = (FFNN_ALIGNMENT < 16) ? 16 : FFNN_ALIGNMENT;
+
+static_assert(Alignment == 16 || Alignment == 32 || Alignment == 64,
+              "FFNN_ALIGNMENT must be one of 16, 32 or 64 bytes.");
+
+/// Alignment option used for memory-mapped matrix/vector types
+#ifdef FFNN_DISABLE_ALIGNMENT
+static constexpr int MapAlignment = Eigen::Unaligned;
+#else
+static constexpr int MapAlignment = Alignment;
+#endif
+
+/**
+ * @brief Checks if a memory location is aligned to a byte boundary
+ * @param ptr  memory location
+ * @param alignment  byte boundary
+ */
+inline bool isAligned(const void* ptr, int alignment = Alignment)
 {
-  // Inherit base type assets
-  using Base = std::vector<ValueType, Eigen::aligned_allocator<ValueType>>;
-  using Base::Base;
-};
+  return (alignment <= 0) || (reinterpret_cast<std::uintptr_t>(ptr) % alignment) == 0;
+}
 
-template<typename MatrixType, typename ValueType>
-struct MapBase;
+/**
+ * @brief Pads a buffer offset (in elements) to the next aligned segment boundary
+ * @param offset  element offset from the start of an aligned buffer
+ * @return smallest aligned offset greater than or equal to <code>offset</code>
+ */
+template<typename ValueType>
+inline FFNN_OFFSET_TYPE padOffset(FFNN_OFFSET_TYPE offset)
+{
+  static constexpr FFNN_OFFSET_TYPE step = (sizeof(ValueType) < Alignment) ?
+                                           (Alignment / sizeof(ValueType)) : 1;
+  return ((offset + step - 1) / step) * step;
+}
 
-template<typename MatrixType>
-struct MapBase<MatrixType, float> :
-  Eigen::Map<MatrixType, 16>
+/**
+ * @brief Standard allocator which aligns memory to <code>AlignmentBytes</code>
+ * @note  Blocks are taken from the <code>memory::Resource</code> which was current
+ *        (see <code>memory::setResource</code>) when the allocator was created
+ * @note  Swapped and move-assigned containers take the allocator (and resource) of their source,
+ *        so blocks are always returned to the resource they came from; copy-assigned containers
+ *        keep their own resource
+ */
+template<typename ValueType, int AlignmentBytes = Alignment>
+struct Allocator
 {
-  // Inherit base type assets
-  using Base = Eigen::Map<MatrixType, 16>;
-  using Base::Base;
+  typedef ValueType value_type;
 
-  // Scalar type standardization
-  typedef double ScalarType;
+  /// Containers swap allocators along with their blocks
+  typedef std::true_type propagate_on_container_swap;
 
-  // Size type standardization
-  typedef typename MatrixType::Index SizeType;
+  /// Move-assigned containers take the allocator of their source along with its blocks
+  typedef std::true_type propagate_on_container_move_assignment;
+
+  template<typename OtherValueType>
+  struct rebind
+  {
+    typedef Allocator<OtherValueType, AlignmentBytes> other;
+  };
 
-  MapBase(ScalarType* data, SizeType rows, SizeType cols) :
-    Base(data, rows, cols)
+  Allocator() :
+    resource(memory::getResource())
   {}
-  virtual ~MapBase() {}
+
+  explicit
+  Allocator(memory::Resource* resource) :
+    resource(resource)
+  {}
+
+  template<typename OtherValueType>
+  Allocator(const Allocator<OtherValueType, AlignmentBytes>& other) :
+    resource(other.resource)
+  {}
+
+  /**
+   * @brief Allocates an aligned block for <code>n</code> elements
+   */
+  ValueType* allocate(std::size_t n)
+  {
+    return reinterpret_cast<ValueType*>(resource->allocate(n * sizeof(ValueType), AlignmentBytes));
+  }
+
+  /**
+   * @brief Deallocates a block created with <code>allocate</code>
+   */
+  void deallocate(ValueType* ptr, std::size_t n)
+  {
+    resource->deallocate(ptr, n * sizeof(ValueType), AlignmentBytes);
+  }
+
+  /// Resource providing memory blocks
+  memory::Resource* resource;
 };
 
-template<typename MatrixType>
-struct MapBase<MatrixType, double> :
-  Eigen::Map<MatrixType, 32>
+template<typename T, typename U, int AlignmentBytes>
+inline bool operator==(const Allocator<T, AlignmentBytes>& lhs, const Allocator<U, AlignmentBytes>& rhs)
 {
-  // Inherit base type assets
-  using Base = Eigen::Map<MatrixType, 32>;
-  using Base::Base;
-
-  // Scalar type standardization
-  typedef double ScalarType;
+  return lhs.resource == rhs.resource;
+}
 
-  // Size type standardization
-  typedef typename MatrixType::Index SizeType;
+template<typename T, typename U, int AlignmentBytes>
+inline bool operator!=(const Allocator<T, AlignmentBytes>& lhs, const Allocator<U, AlignmentBytes>& rhs)
+{
+  return lhs.resource != rhs.resource;
+}
 
-  MapBase(ScalarType* data, SizeType rows, SizeType cols) :
-    Base(data, rows, cols)
-  {}
-  virtual ~MapBase() {}
+template<typename ValueType>
+struct Buffer :
+  public std::vector<ValueType, Allocator<ValueType>>
+{
+  // Inherit base type assets
+  using Base = std::vector<ValueType, Allocator<ValueType>>;
+  using Base::Base;
 };
 
-/// Aligned mem-mapped matrix/vector type wrapper
-template<typename MatrixType>
+/**
+ * @brief Aligned mem-mapped matrix/vector type wrapper
+ * @note  <code>MapOptions</code> reflects the true alignment of mapped data, which is
+ *        guaranteed by <code>Buffer</code> allocation and <code>padOffset</code> segment planning
+ * @note  Held by value and re-seated with <code>remap</code>; has no virtual members
+ */
+template<typename MatrixType, int MapOptions = MapAlignment>
 struct Map :
-  public MapBase<MatrixType, typename MatrixType::Scalar>
+  public Eigen::Map<MatrixType, MapOptions>
 {
   // Inherit base type assets
-  using Base = MapBase<MatrixType, typename MatrixType::Scalar>;
+  using Base = Eigen::Map<MatrixType, MapOptions>;
   using Base::Base;
+  using Base::operator=;
 
-  /// Shared resource standardization
-  typedef boost::shared_ptr<Map> Ptr;
+  /// Scalar type standardization
+  typedef typename MatrixType::Scalar ScalarType;
 
-  /// Constant shared resource standardization
-  typedef boost::shared_ptr<const Map> ConstPtr;
+  /// Size type standardization
+  typedef typename MatrixType::Index SizeType;
 
   /**
-   * @brief Creates a shared-resource pointer to a mapped vector
+   * @brief Default constructor
+   * @note  Creates an empty (unmapped) view
+   */
+  Map() :
+    Base(NULL,
+         (MatrixType::RowsAtCompileTime == Eigen::Dynamic) ? 0 : MatrixType::RowsAtCompileTime,
+         (MatrixType::ColsAtCompileTime == Eigen::Dynamic) ? 0 : MatrixType::ColsAtCompileTime)
+  {}
+
+  /**
+   * @brief Re-seats the view on a new memory location
    * @param data  pointer to first element of a raw buffer
    * @param rows  number of rows represented in the buffer
    * @param cols  number of collumns represented in the buffer
-   * @return shared-resource pointer
    */
-  static typename Map<MatrixType>::Ptr
-  create(typename MatrixType::Scalar* data,
-         typename MatrixType::Index rows,
-         typename MatrixType::Index cols = 1)
+  inline void remap(ScalarType* data, SizeType rows, SizeType cols = 1)
+  {
+    FFNN_ASSERT_MSG(isAligned(data, MapOptions), "Mapped data is not aligned.");
+    new (this) Map(data, rows, cols);
+  }
+
+  /**
+   * @brief Checks if the view is mapped to a memory location
+   */
+  inline bool isMapped() const
   {
-    return boost::make_shared<Map<MatrixType>>(data, rows, cols);
+    return Base::data() != NULL;
   }
 };
 }  // namespace aligned
@@ -14,6 +14,7 @@
  * - <code>FFNN_NO_OPTIMIZER_SUPPORT</code>: force-excluded network training support from compilation
  * - <code>FFNN_NO_ASSERT</code>: disables run-time assertions
  * - <code>FFNN_NO_LOGGING</code>: disables debugging printouts
+ * - <code>FFNN_ALIGNMENT</code>: byte alignment of layer buffers and buffer segments (16, 32 or 64)
  * @}
  *
  * @section overrides Compile-time configuration overrides
@@ -22,6 +23,7 @@
  * - <code>FFNN_ALLOW_LOGGING</code>: force enables debugging printouts
  * - <code>FFNN_SUPRESS_ERROR_LOGGING</code>: suppresses error message
  * - <code>FFNN_DISABLE_ALIGNMENT</code>: disables matrix vectorization
+ * - <code>FFNN_NO_CPU_DISPATCH</code>: disables run-time instruction set selection for hot kernels
  * @}
  * 
  * @author Brian Cairl
@@ -72,4 +74,9 @@
 #include <Eigen/Core>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+
+// Buffer alignment (defaults to widest SIMD alignment enabled for Eigen)
+#ifndef FFNN_ALIGNMENT
+#define FFNN_ALIGNMENT EIGEN_MAX_ALIGN_BYTES
+#endif
 #endif  // FFNN_GLOBAL_H
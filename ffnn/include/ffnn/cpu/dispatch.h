@@ -0,0 +1,118 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_CPU_DISPATCH_H
+#define FFNN_CPU_DISPATCH_H
+
+// C++ Standard Library
+#include <atomic>
+
+// FFNN
+#include <ffnn/config/global.h>
+
+/// Run-time instruction set dispatch is only available for x86 targets with GCC/Clang builtins
+#if !defined(FFNN_NO_CPU_DISPATCH) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FFNN_CPU_DISPATCH 1
+#endif
+
+namespace ffnn
+{
+namespace cpu
+{
+/**
+ * @brief Instruction set levels with dedicated kernel builds, in increasing order
+ */
+enum class ISA : int
+{
+  Generic = 0,  ///< Build-time instruction set
+  SSE42   = 1,  ///< SSE4.2
+  AVX2    = 2,  ///< AVX2 + FMA
+  AVX512  = 3   ///< AVX-512F
+};
+
+/**
+ * @brief Returns a printable name for an instruction set level
+ */
+inline const char* name(ISA isa)
+{
+  switch (isa)
+  {
+  case ISA::SSE42:  return "SSE4.2";
+  case ISA::AVX2:   return "AVX2";
+  case ISA::AVX512: return "AVX-512";
+  default:          return "Generic";
+  }
+}
+
+/**
+ * @brief Detects the highest instruction set level supported by the host CPU
+ */
+inline ISA detect()
+{
+#ifdef FFNN_CPU_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+  {
+    return ISA::AVX512;
+  }
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+  {
+    return ISA::AVX2;
+  }
+  else if (__builtin_cpu_supports("sse4.2"))
+  {
+    return ISA::SSE42;
+  }
+#endif
+  return ISA::Generic;
+}
+
+/**
+ * @brief Checks if kernels for an instruction set level can run on the host CPU
+ */
+inline bool isSupported(ISA isa)
+{
+  static const ISA host = detect();
+  return static_cast<int>(isa) <= static_cast<int>(host);
+}
+
+namespace internal
+{
+/// Selected instruction set level; detected once, on first use
+inline std::atomic<int>& selected()
+{
+  static std::atomic<int> isa(static_cast<int>(detect()));
+  return isa;
+}
+}  // namespace internal
+
+/**
+ * @brief Returns the instruction set level used by dispatched kernels
+ */
+inline ISA active()
+{
+  return static_cast<ISA>(internal::selected().load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Forces dispatched kernels onto a particular instruction set level
+ * @param isa  instruction set level
+ * @retval true  if <code>isa</code> is supported by the host CPU
+ * @retval false  otherwise (selection is unchanged)
+ * @note  May be called while other threads run kernels; each kernel call runs entirely on the
+ *        level selected when it was dispatched
+ */
+inline bool select(ISA isa)
+{
+  if (!isSupported(isa))
+  {
+    FFNN_ERROR_NAMED("cpu::select", name(isa) << " is not supported on this host.");
+    return false;
+  }
+  internal::selected().store(static_cast<int>(isa), std::memory_order_relaxed);
+  return true;
+}
+}  // namespace cpu
+}  // namespace ffnn
+#endif  // FFNN_CPU_DISPATCH_H
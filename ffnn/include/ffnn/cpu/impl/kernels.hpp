@@ -0,0 +1,601 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <type_traits>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/assert.h>
+
+/// Forces kernel bodies to be inlined into (and vectorized for) each instruction set wrapper
+#if defined(__GNUC__)
+#define FFNN_CPU_INLINE inline __attribute__((always_inline))
+#define FFNN_CPU_RESTRICT __restrict__
+#else
+#define FFNN_CPU_INLINE inline
+#define FFNN_CPU_RESTRICT
+#endif
+
+namespace ffnn
+{
+namespace cpu
+{
+namespace internal
+{
+/**
+ * @brief Hints that <code>ptr</code> is aligned to <code>aligned::Alignment</code>, if <code>Aligned</code>
+ * @note  Only used on pointers which the kernel wrappers have checked
+ */
+template<bool Aligned, typename PointerType>
+FFNN_CPU_INLINE PointerType* hint(PointerType* ptr)
+{
+#if defined(__GNUC__) && !defined(FFNN_DISABLE_ALIGNMENT)
+  return Aligned ? static_cast<PointerType*>(__builtin_assume_aligned(ptr, aligned::Alignment)) : ptr;
+#else
+  return ptr;
+#endif
+}
+
+/**
+ * @brief Checks that all columns of a column-major matrix with <code>rows</code> rows start on
+ *        aligned boundaries, given an aligned first column
+ */
+template<typename ScalarType>
+inline bool isColumnAligned(FFNN_SIZE_TYPE rows)
+{
+  return (rows * sizeof(ScalarType)) % aligned::Alignment == 0;
+}
+
+template<typename ScalarType, bool Aligned>
+FFNN_CPU_INLINE void affineImpl(const ScalarType* FFNN_CPU_RESTRICT w,
+                                const ScalarType* FFNN_CPU_RESTRICT x,
+                                const ScalarType* FFNN_CPU_RESTRICT b,
+                                ScalarType* FFNN_CPU_RESTRICT y,
+                                FFNN_SIZE_TYPE rows,
+                                FFNN_SIZE_TYPE cols)
+{
+  y = hint<Aligned>(y);
+  for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+  {
+    y[i] = b ? hint<Aligned>(b)[i] : ScalarType(0);
+  }
+
+  // Accumulate four columns at a time to reduce passes over y
+  FFNN_SIZE_TYPE j = 0;
+  for (; j + 4 <= cols; j += 4)
+  {
+    const ScalarType* c0 = hint<Aligned>(w + (j + 0) * rows);
+    const ScalarType* c1 = hint<Aligned>(w + (j + 1) * rows);
+    const ScalarType* c2 = hint<Aligned>(w + (j + 2) * rows);
+    const ScalarType* c3 = hint<Aligned>(w + (j + 3) * rows);
+    const ScalarType x0 = x[j + 0], x1 = x[j + 1], x2 = x[j + 2], x3 = x[j + 3];
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      y[i] += c0[i] * x0 + c1[i] * x1 + c2[i] * x2 + c3[i] * x3;
+    }
+  }
+  for (; j < cols; j++)
+  {
+    const ScalarType* c = hint<Aligned>(w + j * rows);
+    const ScalarType xj = x[j];
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      y[i] += c[i] * xj;
+    }
+  }
+}
+
+template<typename ScalarType, int Lanes, bool Aligned>
+FFNN_CPU_INLINE void transposeProductImpl(const ScalarType* FFNN_CPU_RESTRICT w,
+                                          const ScalarType* FFNN_CPU_RESTRICT x,
+                                          ScalarType* FFNN_CPU_RESTRICT y,
+                                          FFNN_SIZE_TYPE rows,
+                                          FFNN_SIZE_TYPE cols)
+{
+  x = hint<Aligned>(x);
+  for (FFNN_SIZE_TYPE j = 0; j < cols; j++)
+  {
+    const ScalarType* c = hint<Aligned>(w + j * rows);
+
+    // Independent per-lane partial sums vectorize without re-associating additions
+    ScalarType acc[Lanes];
+    for (int l = 0; l < Lanes; l++)
+    {
+      acc[l] = ScalarType(0);
+    }
+
+    FFNN_SIZE_TYPE i = 0;
+    for (; i + Lanes <= rows; i += Lanes)
+    {
+      for (int l = 0; l < Lanes; l++)
+      {
+        acc[l] += c[i + l] * x[i + l];
+      }
+    }
+
+    ScalarType sum = ScalarType(0);
+    for (int l = 0; l < Lanes; l++)
+    {
+      sum += acc[l];
+    }
+    for (; i < rows; i++)
+    {
+      sum += c[i] * x[i];
+    }
+    y[j] = sum;
+  }
+}
+
+template<typename ScalarType, bool Aligned>
+FFNN_CPU_INLINE void rankUpdateImpl(ScalarType* FFNN_CPU_RESTRICT a,
+                                    const ScalarType* FFNN_CPU_RESTRICT x,
+                                    const ScalarType* FFNN_CPU_RESTRICT y,
+                                    FFNN_SIZE_TYPE rows,
+                                    FFNN_SIZE_TYPE cols)
+{
+  x = hint<Aligned>(x);
+  for (FFNN_SIZE_TYPE j = 0; j < cols; j++)
+  {
+    ScalarType* c = hint<Aligned>(a + j * rows);
+    const ScalarType yj = y[j];
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      c[i] += x[i] * yj;
+    }
+  }
+}
+
+template<typename ScalarType, bool Aligned>
+FFNN_CPU_INLINE void gatherAffineImpl(const ScalarType* FFNN_CPU_RESTRICT w,
+                                      const FFNN_SIZE_TYPE* FFNN_CPU_RESTRICT idx,
+                                      const ScalarType* FFNN_CPU_RESTRICT x,
+                                      const ScalarType* FFNN_CPU_RESTRICT b,
+                                      ScalarType* FFNN_CPU_RESTRICT y,
+                                      FFNN_SIZE_TYPE rows,
+                                      FFNN_SIZE_TYPE count)
+{
+  y = hint<Aligned>(y);
+  for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+  {
+    y[i] = b ? hint<Aligned>(b)[i] : ScalarType(0);
+  }
+
+  // Accumulate four gathered columns at a time to reduce passes over y
+  FFNN_SIZE_TYPE k = 0;
+  for (; k + 4 <= count; k += 4)
+  {
+    const ScalarType* c0 = hint<Aligned>(w + idx[k + 0] * rows);
+    const ScalarType* c1 = hint<Aligned>(w + idx[k + 1] * rows);
+    const ScalarType* c2 = hint<Aligned>(w + idx[k + 2] * rows);
+    const ScalarType* c3 = hint<Aligned>(w + idx[k + 3] * rows);
+    const ScalarType x0 = x[idx[k + 0]], x1 = x[idx[k + 1]], x2 = x[idx[k + 2]], x3 = x[idx[k + 3]];
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      y[i] += c0[i] * x0 + c1[i] * x1 + c2[i] * x2 + c3[i] * x3;
+    }
+  }
+  for (; k < count; k++)
+  {
+    const ScalarType* c = hint<Aligned>(w + idx[k] * rows);
+    const ScalarType xk = x[idx[k]];
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      y[i] += c[i] * xk;
+    }
+  }
+}
+
+template<typename ScalarType, bool Aligned>
+FFNN_CPU_INLINE void scatterRankUpdateImpl(ScalarType* FFNN_CPU_RESTRICT a,
+                                           const ScalarType* FFNN_CPU_RESTRICT x,
+                                           const FFNN_SIZE_TYPE* FFNN_CPU_RESTRICT idx,
+                                           const ScalarType* FFNN_CPU_RESTRICT v,
+                                           FFNN_SIZE_TYPE rows,
+                                           FFNN_SIZE_TYPE count)
+{
+  x = hint<Aligned>(x);
+  for (FFNN_SIZE_TYPE k = 0; k < count; k++)
+  {
+    ScalarType* c = hint<Aligned>(a + idx[k] * rows);
+    const ScalarType vk = v[k];
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      c[i] += x[i] * vk;
+    }
+  }
+}
+
+template<typename ScalarType, bool Aligned>
+FFNN_CPU_INLINE void axpyImpl(ScalarType alpha,
+                              const ScalarType* FFNN_CPU_RESTRICT x,
+                              ScalarType* FFNN_CPU_RESTRICT y,
+                              FFNN_SIZE_TYPE size)
+{
+  x = hint<Aligned>(x);
+  y = hint<Aligned>(y);
+  for (FFNN_SIZE_TYPE i = 0; i < size; i++)
+  {
+    y[i] += alpha * x[i];
+  }
+}
+
+template<typename ScalarType, int Lanes>
+FFNN_CPU_INLINE void batchAffineImpl(const ScalarType* FFNN_CPU_RESTRICT w,
+                                     const ScalarType* FFNN_CPU_RESTRICT x,
+                                     FFNN_SIZE_TYPE ldx,
+                                     const ScalarType* FFNN_CPU_RESTRICT b,
+                                     ScalarType* FFNN_CPU_RESTRICT y,
+                                     FFNN_SIZE_TYPE ldy,
+                                     FFNN_SIZE_TYPE rows,
+                                     FFNN_SIZE_TYPE cols,
+                                     FFNN_SIZE_TYPE count)
+{
+  // Tiles of output rows and samples are accumulated in registers, so each weight is loaded once per tile
+  static const int TileRows = 2 * Lanes;
+  static const int TileSamples = 4;
+
+  FFNN_SIZE_TYPE n = 0;
+  for (; n + TileSamples <= count; n += TileSamples)
+  {
+    const ScalarType* xn = x + n * ldx;
+    ScalarType* yn = y + n * ldy;
+
+    FFNN_SIZE_TYPE i = 0;
+    for (; i + TileRows <= rows; i += TileRows)
+    {
+      ScalarType acc[TileSamples][TileRows];
+      for (int s = 0; s < TileSamples; s++)
+      {
+        for (int l = 0; l < TileRows; l++)
+        {
+          acc[s][l] = b ? b[i + l] : ScalarType(0);
+        }
+      }
+      for (FFNN_SIZE_TYPE j = 0; j < cols; j++)
+      {
+        const ScalarType* c = w + j * rows + i;
+        for (int s = 0; s < TileSamples; s++)
+        {
+          const ScalarType xj = xn[s * ldx + j];
+          for (int l = 0; l < TileRows; l++)
+          {
+            acc[s][l] += c[l] * xj;
+          }
+        }
+      }
+      for (int s = 0; s < TileSamples; s++)
+      {
+        for (int l = 0; l < TileRows; l++)
+        {
+          yn[s * ldy + i + l] = acc[s][l];
+        }
+      }
+    }
+
+    // Remaining rows, one sample at a time
+    if (i < rows)
+    {
+      for (int s = 0; s < TileSamples; s++)
+      {
+        const ScalarType* xs = xn + s * ldx;
+        ScalarType* ys = yn + s * ldy;
+        for (FFNN_SIZE_TYPE r = i; r < rows; r++)
+        {
+          ys[r] = b ? b[r] : ScalarType(0);
+        }
+        for (FFNN_SIZE_TYPE j = 0; j < cols; j++)
+        {
+          const ScalarType* c = w + j * rows;
+          const ScalarType xj = xs[j];
+          for (FFNN_SIZE_TYPE r = i; r < rows; r++)
+          {
+            ys[r] += c[r] * xj;
+          }
+        }
+      }
+    }
+  }
+
+  // Remaining samples
+  for (; n < count; n++)
+  {
+    affineImpl<ScalarType, false>(w, x + n * ldx, b, y + n * ldy, rows, cols);
+  }
+}
+
+template<typename ScalarType>
+FFNN_CPU_INLINE void sparseBatchAffineImpl(const ScalarType* FFNN_CPU_RESTRICT values,
+                                           const FFNN_SIZE_TYPE* FFNN_CPU_RESTRICT inner,
+                                           const FFNN_SIZE_TYPE* FFNN_CPU_RESTRICT outer,
+                                           const ScalarType* FFNN_CPU_RESTRICT x,
+                                           FFNN_SIZE_TYPE ldx,
+                                           const ScalarType* FFNN_CPU_RESTRICT b,
+                                           ScalarType* FFNN_CPU_RESTRICT y,
+                                           FFNN_SIZE_TYPE ldy,
+                                           FFNN_SIZE_TYPE rows,
+                                           FFNN_SIZE_TYPE cols,
+                                           FFNN_SIZE_TYPE count)
+{
+  for (FFNN_SIZE_TYPE n = 0; n < count; n++)
+  {
+    ScalarType* yn = y + n * ldy;
+    for (FFNN_SIZE_TYPE i = 0; i < rows; i++)
+    {
+      yn[i] = b ? b[i] : ScalarType(0);
+    }
+  }
+
+  // Scatter each stored weight into four samples at a time, so weights are loaded once per pass
+  FFNN_SIZE_TYPE n = 0;
+  for (; n + 4 <= count; n += 4)
+  {
+    const ScalarType* x0 = x + (n + 0) * ldx;
+    const ScalarType* x1 = x + (n + 1) * ldx;
+    const ScalarType* x2 = x + (n + 2) * ldx;
+    const ScalarType* x3 = x + (n + 3) * ldx;
+    ScalarType* y0 = y + (n + 0) * ldy;
+    ScalarType* y1 = y + (n + 1) * ldy;
+    ScalarType* y2 = y + (n + 2) * ldy;
+    ScalarType* y3 = y + (n + 3) * ldy;
+    for (FFNN_SIZE_TYPE j = 0; j < cols; j++)
+    {
+      const ScalarType a0 = x0[j], a1 = x1[j], a2 = x2[j], a3 = x3[j];
+      for (FFNN_SIZE_TYPE k = outer[j]; k < outer[j + 1]; k++)
+      {
+        const ScalarType v = values[k];
+        const FFNN_SIZE_TYPE r = inner[k];
+        y0[r] += v * a0;
+        y1[r] += v * a1;
+        y2[r] += v * a2;
+        y3[r] += v * a3;
+      }
+    }
+  }
+  for (; n < count; n++)
+  {
+    const ScalarType* xn = x + n * ldx;
+    ScalarType* yn = y + n * ldy;
+    for (FFNN_SIZE_TYPE j = 0; j < cols; j++)
+    {
+      const ScalarType a = xn[j];
+      for (FFNN_SIZE_TYPE k = outer[j]; k < outer[j + 1]; k++)
+      {
+        yn[inner[k]] += values[k] * a;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Defines a kernel table <code>NAME</code>, compiled with function attributes <code>ATTR</code>
+ * @note  Dense kernels run a variant with alignment hints when all columns and vectors they stream
+ *        over are aligned, e.g. for layer buffers whose row count fills whole aligned blocks
+ */
+#define FFNN_CPU_DEFINE_KERNELS(NAME, ATTR, BYTES)\
+  template<typename ScalarType>\
+  struct NAME\
+  {\
+    ATTR static void affine(const ScalarType* w, const ScalarType* x, const ScalarType* b, ScalarType* y,\
+                            FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE cols)\
+    {\
+      if (isColumnAligned<ScalarType>(rows) && aligned::isAligned(w) && aligned::isAligned(b) && aligned::isAligned(y))\
+      {\
+        affineImpl<ScalarType, true>(w, x, b, y, rows, cols);\
+      }\
+      else\
+      {\
+        affineImpl<ScalarType, false>(w, x, b, y, rows, cols);\
+      }\
+    }\
+    ATTR static void transposeProduct(const ScalarType* w, const ScalarType* x, ScalarType* y,\
+                                      FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE cols)\
+    {\
+      if (isColumnAligned<ScalarType>(rows) && aligned::isAligned(w) && aligned::isAligned(x))\
+      {\
+        transposeProductImpl<ScalarType, BYTES / sizeof(ScalarType), true>(w, x, y, rows, cols);\
+      }\
+      else\
+      {\
+        transposeProductImpl<ScalarType, BYTES / sizeof(ScalarType), false>(w, x, y, rows, cols);\
+      }\
+    }\
+    ATTR static void rankUpdate(ScalarType* a, const ScalarType* x, const ScalarType* y,\
+                                FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE cols)\
+    {\
+      if (isColumnAligned<ScalarType>(rows) && aligned::isAligned(a) && aligned::isAligned(x))\
+      {\
+        rankUpdateImpl<ScalarType, true>(a, x, y, rows, cols);\
+      }\
+      else\
+      {\
+        rankUpdateImpl<ScalarType, false>(a, x, y, rows, cols);\
+      }\
+    }\
+    ATTR static void gatherAffine(const ScalarType* w, const FFNN_SIZE_TYPE* idx, const ScalarType* x,\
+                                  const ScalarType* b, ScalarType* y, FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE count)\
+    {\
+      if (isColumnAligned<ScalarType>(rows) && aligned::isAligned(w) && aligned::isAligned(b) && aligned::isAligned(y))\
+      {\
+        gatherAffineImpl<ScalarType, true>(w, idx, x, b, y, rows, count);\
+      }\
+      else\
+      {\
+        gatherAffineImpl<ScalarType, false>(w, idx, x, b, y, rows, count);\
+      }\
+    }\
+    ATTR static void scatterRankUpdate(ScalarType* a, const ScalarType* x, const FFNN_SIZE_TYPE* idx,\
+                                       const ScalarType* v, FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE count)\
+    {\
+      if (isColumnAligned<ScalarType>(rows) && aligned::isAligned(a) && aligned::isAligned(x))\
+      {\
+        scatterRankUpdateImpl<ScalarType, true>(a, x, idx, v, rows, count);\
+      }\
+      else\
+      {\
+        scatterRankUpdateImpl<ScalarType, false>(a, x, idx, v, rows, count);\
+      }\
+    }\
+    ATTR static void axpy(ScalarType alpha, const ScalarType* x, ScalarType* y, FFNN_SIZE_TYPE size)\
+    {\
+      if (aligned::isAligned(x) && aligned::isAligned(y))\
+      {\
+        axpyImpl<ScalarType, true>(alpha, x, y, size);\
+      }\
+      else\
+      {\
+        axpyImpl<ScalarType, false>(alpha, x, y, size);\
+      }\
+    }\
+    ATTR static void batchAffine(const ScalarType* w, const ScalarType* x, FFNN_SIZE_TYPE ldx,\
+                                 const ScalarType* b, ScalarType* y, FFNN_SIZE_TYPE ldy,\
+                                 FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE cols, FFNN_SIZE_TYPE count)\
+    {\
+      batchAffineImpl<ScalarType, BYTES / sizeof(ScalarType)>(w, x, ldx, b, y, ldy, rows, cols, count);\
+    }\
+    ATTR static void sparseBatchAffine(const ScalarType* values, const FFNN_SIZE_TYPE* inner,\
+                                       const FFNN_SIZE_TYPE* outer, const ScalarType* x, FFNN_SIZE_TYPE ldx,\
+                                       const ScalarType* b, ScalarType* y, FFNN_SIZE_TYPE ldy,\
+                                       FFNN_SIZE_TYPE rows, FFNN_SIZE_TYPE cols, FFNN_SIZE_TYPE count)\
+    {\
+      sparseBatchAffineImpl<ScalarType>(values, inner, outer, x, ldx, b, y, ldy, rows, cols, count);\
+    }\
+    static const Kernels<ScalarType>& table()\
+    {\
+      static const Kernels<ScalarType> t = {&NAME::affine,\
+                                            &NAME::transposeProduct,\
+                                            &NAME::rankUpdate,\
+                                            &NAME::gatherAffine,\
+                                            &NAME::scatterRankUpdate,\
+                                            &NAME::axpy,\
+                                            &NAME::batchAffine,\
+                                            &NAME::sparseBatchAffine};\
+      return t;\
+    }\
+  };
+
+FFNN_CPU_DEFINE_KERNELS(GenericKernels, , 16)
+#ifdef FFNN_CPU_DISPATCH
+FFNN_CPU_DEFINE_KERNELS(SSE42Kernels, __attribute__((target("sse4.2"))), 16)
+FFNN_CPU_DEFINE_KERNELS(AVX2Kernels, __attribute__((target("avx2,fma"))), 32)
+FFNN_CPU_DEFINE_KERNELS(AVX512Kernels, __attribute__((target("avx512f"))), 64)
+#endif
+#undef FFNN_CPU_DEFINE_KERNELS
+
+/// Checks that an Eigen object is stored contiguously in column-major order
+template<typename MatrixType>
+inline bool isContiguous(const MatrixType& m)
+{
+  return (m.innerStride() == 1) && (m.cols() == 1 || (!MatrixType::IsRowMajor && m.outerStride() == m.rows()));
+}
+}  // namespace internal
+
+template<typename ScalarType>
+const Kernels<ScalarType>& kernels(ISA isa)
+{
+#ifdef FFNN_CPU_DISPATCH
+  switch (isa)
+  {
+  case ISA::AVX512: return internal::AVX512Kernels<ScalarType>::table();
+  case ISA::AVX2:   return internal::AVX2Kernels<ScalarType>::table();
+  case ISA::SSE42:  return internal::SSE42Kernels<ScalarType>::table();
+  default:          break;
+  }
+#endif
+  return internal::GenericKernels<ScalarType>::table();
+}
+
+template<typename WeightMatrix, typename InputVector, typename BiasVector, typename OutputVector>
+void affine(const WeightMatrix& w, const InputVector& x, const BiasVector& b, OutputVector& y)
+{
+  typedef typename WeightMatrix::Scalar ScalarType;
+  FFNN_ASSERT_MSG(w.cols() == x.size() && w.rows() == y.size() && b.size() == y.size(),
+                  "Dimension mismatch.");
+  FFNN_ASSERT_MSG(internal::isContiguous(w), "Weight matrix must be contiguous and column-major.");
+  kernels<ScalarType>().affine(w.data(), x.data(), b.data(), y.data(), w.rows(), w.cols());
+}
+
+template<typename WeightMatrix, typename InputVector, typename OutputVector>
+void transposeProduct(const WeightMatrix& w, const InputVector& x, OutputVector& y)
+{
+  typedef typename WeightMatrix::Scalar ScalarType;
+  FFNN_ASSERT_MSG(w.rows() == x.size() && w.cols() == y.size(), "Dimension mismatch.");
+  FFNN_ASSERT_MSG(internal::isContiguous(w), "Weight matrix must be contiguous and column-major.");
+  kernels<ScalarType>().transposeProduct(w.data(), x.data(), y.data(), w.rows(), w.cols());
+}
+
+template<typename Matrix, typename LeftVector, typename RightVector>
+void rankUpdate(Matrix& a, const LeftVector& x, const RightVector& y)
+{
+  typedef typename Matrix::Scalar ScalarType;
+  FFNN_ASSERT_MSG(a.rows() == x.size() && a.cols() == y.size(), "Dimension mismatch.");
+  FFNN_ASSERT_MSG(internal::isContiguous(a), "Updated matrix must be contiguous and column-major.");
+  kernels<ScalarType>().rankUpdate(a.data(), x.data(), y.data(), a.rows(), a.cols());
+}
+
+template<typename WeightMatrix, typename InputVector, typename BiasVector, typename OutputVector>
+void gatherAffine(const WeightMatrix& w,
+                  const FFNN_SIZE_TYPE* indices,
+                  FFNN_SIZE_TYPE count,
+                  const InputVector& x,
+                  const BiasVector& b,
+                  OutputVector& y)
+{
+  typedef typename WeightMatrix::Scalar ScalarType;
+  FFNN_ASSERT_MSG(w.cols() == x.size() && w.rows() == y.size() && b.size() == y.size(),
+                  "Dimension mismatch.");
+  FFNN_ASSERT_MSG(internal::isContiguous(w), "Weight matrix must be contiguous and column-major.");
+  kernels<ScalarType>().gatherAffine(w.data(), indices, x.data(), b.data(), y.data(), w.rows(), count);
+}
+
+template<typename Matrix, typename LeftVector>
+void scatterRankUpdate(Matrix& a,
+                       const LeftVector& x,
+                       const FFNN_SIZE_TYPE* indices,
+                       const typename Matrix::Scalar* values,
+                       FFNN_SIZE_TYPE count)
+{
+  typedef typename Matrix::Scalar ScalarType;
+  FFNN_ASSERT_MSG(a.rows() == x.size(), "Dimension mismatch.");
+  FFNN_ASSERT_MSG(internal::isContiguous(a), "Updated matrix must be contiguous and column-major.");
+  kernels<ScalarType>().scatterRankUpdate(a.data(), x.data(), indices, values, a.rows(), count);
+}
+
+template<typename ScalarType, typename InputType, typename OutputType>
+void axpy(ScalarType alpha, const InputType& x, OutputType& y)
+{
+  FFNN_ASSERT_MSG(x.size() == y.size(), "Dimension mismatch.");
+  kernels<typename OutputType::Scalar>().axpy(alpha, x.data(), y.data(), y.size());
+}
+
+template<typename WeightMatrix, typename InputMatrix, typename BiasVector, typename OutputMatrix>
+void batchAffine(const WeightMatrix& w, const InputMatrix& x, const BiasVector& b, OutputMatrix& y)
+{
+  typedef typename WeightMatrix::Scalar ScalarType;
+  FFNN_ASSERT_MSG(w.cols() == x.rows() && w.rows() == y.rows() && x.cols() == y.cols() && b.size() == y.rows(),
+                  "Dimension mismatch.");
+  FFNN_ASSERT_MSG(internal::isContiguous(w), "Weight matrix must be contiguous and column-major.");
+  FFNN_ASSERT_MSG(x.innerStride() == 1 && y.innerStride() == 1, "Batch columns must be contiguous.");
+  kernels<ScalarType>().batchAffine(w.data(), x.data(), x.outerStride(), b.data(),
+                                    y.data(), y.outerStride(), w.rows(), w.cols(), y.cols());
+}
+
+template<typename SparseMatrix, typename InputMatrix, typename BiasVector, typename OutputMatrix>
+void sparseBatchAffine(const SparseMatrix& w, const InputMatrix& x, const BiasVector& b, OutputMatrix& y)
+{
+  typedef typename SparseMatrix::Scalar ScalarType;
+  static_assert(std::is_same<typename SparseMatrix::StorageIndex, FFNN_SIZE_TYPE>::value,
+                "Sparse matrix indices must be of FFNN_SIZE_TYPE.");
+  FFNN_ASSERT_MSG(w.cols() == x.rows() && w.rows() == y.rows() && x.cols() == y.cols() && b.size() == y.rows(),
+                  "Dimension mismatch.");
+  FFNN_ASSERT_MSG(w.isCompressed() && !SparseMatrix::IsRowMajor,
+                  "Weight matrix must be compressed and column-major.");
+  FFNN_ASSERT_MSG(x.innerStride() == 1 && y.innerStride() == 1, "Batch columns must be contiguous.");
+  kernels<ScalarType>().sparseBatchAffine(w.valuePtr(), w.innerIndexPtr(), w.outerIndexPtr(),
+                                          x.data(), x.outerStride(), b.data(),
+                                          y.data(), y.outerStride(), w.rows(), w.cols(), y.cols());
+}
+}  // namespace cpu
+}  // namespace ffnn
@@ -0,0 +1,138 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_CPU_KERNELS_H
+#define FFNN_CPU_KERNELS_H
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/cpu/dispatch.h>
+
+namespace ffnn
+{
+namespace cpu
+{
+/**
+ * @brief Table of raw (column-major, contiguous) kernels built for one instruction set level
+ */
+template<typename ScalarType>
+struct Kernels
+{
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  /// y = W * x + b  (<code>b</code> may be NULL)
+  void (*affine)(const ScalarType* w, const ScalarType* x, const ScalarType* b, ScalarType* y,
+                 SizeType rows, SizeType cols);
+
+  /// y = W^T * x
+  void (*transposeProduct)(const ScalarType* w, const ScalarType* x, ScalarType* y,
+                           SizeType rows, SizeType cols);
+
+  /// A += x * y^T
+  void (*rankUpdate)(ScalarType* a, const ScalarType* x, const ScalarType* y,
+                     SizeType rows, SizeType cols);
+
+  /// y = W[:, idx] * x[idx] + b  (<code>b</code> may be NULL)
+  void (*gatherAffine)(const ScalarType* w, const SizeType* idx, const ScalarType* x, const ScalarType* b,
+                       ScalarType* y, SizeType rows, SizeType count);
+
+  /// A[:, idx] += x * v^T
+  void (*scatterRankUpdate)(ScalarType* a, const ScalarType* x, const SizeType* idx, const ScalarType* v,
+                            SizeType rows, SizeType count);
+
+  /// y += alpha * x
+  void (*axpy)(ScalarType alpha, const ScalarType* x, ScalarType* y, SizeType size);
+
+  /// Y = W * X + b  over <code>count</code> columns of X and Y, <code>ldx</code>/<code>ldy</code> apart
+  void (*batchAffine)(const ScalarType* w, const ScalarType* x, SizeType ldx, const ScalarType* b,
+                      ScalarType* y, SizeType ldy, SizeType rows, SizeType cols, SizeType count);
+
+  /// Y = W * X + b  for a compressed, column-major sparse W (<code>values</code>, <code>inner</code>, <code>outer</code>)
+  void (*sparseBatchAffine)(const ScalarType* values, const SizeType* inner, const SizeType* outer,
+                            const ScalarType* x, SizeType ldx, const ScalarType* b,
+                            ScalarType* y, SizeType ldy, SizeType rows, SizeType cols, SizeType count);
+};
+
+/**
+ * @brief Returns the kernel table for an instruction set level
+ * @note  Levels which are not built for the current target fall back to <code>ISA::Generic</code>
+ */
+template<typename ScalarType>
+const Kernels<ScalarType>& kernels(ISA isa = active());
+
+/**
+ * @brief Computes <code>y = w * x + b</code> with the active kernels
+ */
+template<typename WeightMatrix, typename InputVector, typename BiasVector, typename OutputVector>
+inline void affine(const WeightMatrix& w, const InputVector& x, const BiasVector& b, OutputVector& y);
+
+/**
+ * @brief Computes <code>y = w^T * x</code> with the active kernels
+ */
+template<typename WeightMatrix, typename InputVector, typename OutputVector>
+inline void transposeProduct(const WeightMatrix& w, const InputVector& x, OutputVector& y);
+
+/**
+ * @brief Computes <code>a += x * y^T</code> with the active kernels
+ */
+template<typename Matrix, typename LeftVector, typename RightVector>
+inline void rankUpdate(Matrix& a, const LeftVector& x, const RightVector& y);
+
+/**
+ * @brief Computes <code>y = w * x + b</code> with the active kernels, where only the elements of
+ *        <code>x</code> listed by <code>indices</code> may be non-zero
+ * @param indices  indices of (possibly) non-zero elements of <code>x</code>
+ * @param count  number of indices
+ * @note  Only the columns of <code>w</code> listed by <code>indices</code> are read
+ */
+template<typename WeightMatrix, typename InputVector, typename BiasVector, typename OutputVector>
+inline void gatherAffine(const WeightMatrix& w,
+                         const FFNN_SIZE_TYPE* indices,
+                         FFNN_SIZE_TYPE count,
+                         const InputVector& x,
+                         const BiasVector& b,
+                         OutputVector& y);
+
+/**
+ * @brief Computes <code>a += x * y^T</code> with the active kernels, where <code>y</code> is sparse
+ * @param indices  indices of (possibly) non-zero elements of <code>y</code>
+ * @param values  values of those elements
+ * @param count  number of indices
+ * @note  Only the columns of <code>a</code> listed by <code>indices</code> are updated
+ */
+template<typename Matrix, typename LeftVector>
+inline void scatterRankUpdate(Matrix& a,
+                              const LeftVector& x,
+                              const FFNN_SIZE_TYPE* indices,
+                              const typename Matrix::Scalar* values,
+                              FFNN_SIZE_TYPE count);
+
+/**
+ * @brief Computes <code>y += alpha * x</code> with the active kernels
+ */
+template<typename ScalarType, typename InputType, typename OutputType>
+inline void axpy(ScalarType alpha, const InputType& x, OutputType& y);
+
+/**
+ * @brief Computes <code>y = w * x + b</code> for each column of <code>x</code> and <code>y</code>
+ *        with the active kernels
+ * @note  <code>x</code> and <code>y</code> may have outer strides, but must not overlap
+ */
+template<typename WeightMatrix, typename InputMatrix, typename BiasVector, typename OutputMatrix>
+inline void batchAffine(const WeightMatrix& w, const InputMatrix& x, const BiasVector& b, OutputMatrix& y);
+
+/**
+ * @brief Computes <code>y = w * x + b</code> for each column of <code>x</code> and <code>y</code>
+ *        with the active kernels, where <code>w</code> is a compressed sparse matrix
+ * @note  <code>x</code> and <code>y</code> may have outer strides, but must not overlap
+ */
+template<typename SparseMatrix, typename InputMatrix, typename BiasVector, typename OutputMatrix>
+inline void sparseBatchAffine(const SparseMatrix& w, const InputMatrix& x, const BiasVector& b, OutputMatrix& y);
+}  // namespace cpu
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/cpu/impl/kernels.hpp>
+#endif  // FFNN_CPU_KERNELS_H
@@ -0,0 +1,115 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_INTERNAL_SPSC_QUEUE_H
+#define FFNN_INTERNAL_SPSC_QUEUE_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ffnn
+{
+namespace internal
+{
+/**
+ * @brief Bounded, lock-free, single-producer/single-consumer queue of pre-allocated slots
+ *
+ *        Slots are filled and read in place: the producer writes the slot returned by
+ *        <code>back</code> and publishes it with <code>push</code>; the consumer reads the slot
+ *        returned by <code>front</code> and releases it with <code>pop</code>.
+ */
+template<typename SlotType>
+class SpscQueue
+{
+public:
+  /**
+   * @brief Setup constructor
+   * @param capacity  number of slots
+   */
+  explicit
+  SpscQueue(std::size_t capacity) :
+    slots_(capacity),
+    head_(0),
+    tail_(0)
+  {}
+
+  /**
+   * @brief Returns number of slots
+   */
+  inline std::size_t capacity() const
+  {
+    return slots_.size();
+  }
+
+  /**
+   * @brief Exposes a slot by index, for setup before the queue is shared
+   */
+  inline SlotType& slot(std::size_t idx)
+  {
+    return slots_[idx];
+  }
+
+  /**
+   * @brief Returns the next free slot, or <code>NULL</code> if the queue is full (producer only)
+   */
+  inline SlotType* back()
+  {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == slots_.size())
+    {
+      return NULL;
+    }
+    return &slots_[head % slots_.size()];
+  }
+
+  /**
+   * @brief Publishes the slot returned by <code>back</code> (producer only)
+   */
+  inline void push()
+  {
+    head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Returns the oldest published slot, or <code>NULL</code> if the queue is empty (consumer only)
+   */
+  inline SlotType* front()
+  {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) == tail)
+    {
+      return NULL;
+    }
+    return &slots_[tail % slots_.size()];
+  }
+
+  /**
+   * @brief Releases the slot returned by <code>front</code> (consumer only)
+   */
+  inline void pop()
+  {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+private:
+  SpscQueue(const SpscQueue&);
+  SpscQueue& operator=(const SpscQueue&);
+
+  /// Slot storage
+  std::vector<SlotType> slots_;
+
+  /// Number of slots published (written by producer)
+  std::atomic<std::size_t> head_;
+
+  /// Keeps producer and consumer counters on separate cache lines
+  char padding_[64];
+
+  /// Number of slots released (written by consumer)
+  std::atomic<std::size_t> tail_;
+};
+}  // namespace internal
+}  // namespace ffnn
+#endif  // FFNN_INTERNAL_SPSC_QUEUE_H
@@ -5,13 +5,21 @@
 #ifndef FFNN_LAYER_ACTIVATION_H
 #define FFNN_LAYER_ACTIVATION_H
 
+// C++ Standard Library
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
 // Boost
 #include <boost/dynamic_bitset.hpp>
 
 // FFNN
+#include <ffnn/aligned_types.h>
 #include <ffnn/config/global.h>
 #include <ffnn/layer/hidden.h>
 #include <ffnn/neuron/neuron.h>
+#include <ffnn/neuron/rectified_linear.h>
+#include <ffnn/neuron/modifier/inverted_dropout.h>
 
 namespace ffnn
 {
@@ -19,6 +27,18 @@ namespace layer
 {
 /**
  * @brief Activation layer
+ *
+ *        Neuron types derived from <code>neuron::modifier::LayerDropout</code> (i.e.
+ *        <code>neuron::modifier::InvertedDropout</code>) are masked by the layer as a whole, in
+ *        training mode only.
+ *
+ *        After each forward pass, outputs may be published to subsequent layers as a compact list of
+ *        non-zero outputs (see <code>setSparseOutputs</code>), which lets layers such as
+ *        <code>FullyConnected</code> skip weights of zero inputs.
+ *
+ *        For neuron types with a binary derivative (see <code>neuron::HasBinaryDerivative</code>), one
+ *        derivative bit per unit is packed during forward propagation, and back-propagation does not
+ *        read layer inputs.
  */
 template<typename ValueType,
          template<class> class NeuronType,
@@ -39,12 +59,61 @@ public:
   /// Offset type standardization
   typedef typename Base::OffsetType OffsetType;
 
+  /// Flags if outputs are masked by layer-level dropout in training mode
+  static constexpr bool HasDropout = std::is_base_of<neuron::modifier::LayerDropout, NeuronType<ValueType>>::value;
+
+  /// Flags if many outputs are expected to be exactly zero (rectified or dropped-out units)
+  static constexpr bool HasSparseOutputs =
+    HasDropout || std::is_base_of<neuron::RectifiedLinear<ValueType>, NeuronType<ValueType>>::value;
+
+  /// Flags if derivatives are kept as one packed bit per unit
+  static constexpr bool HasDerivativeMask = neuron::HasBinaryDerivative<NeuronType<ValueType>>::value;
+
+  /// Default density below which non-zero outputs are published, for neuron types with sparse outputs
+  static constexpr double DefaultMaxActiveDensity = 0.5;
+
   /**
    * @brief Default constructor
    */
   Activation();
   virtual ~Activation();
 
+  /**
+   * @brief Switches between training and evaluation modes
+   * @param training  if true, layer-level dropout masks outputs and back-propagated errors;
+   *                  otherwise, dropout is skipped and its mask is released
+   * @note  Layers are in training mode by default
+   */
+  void setTraining(bool training);
+
+  /**
+   * @brief Returns true if the layer is in training mode
+   */
+  inline bool isTraining() const
+  {
+    return training_;
+  }
+
+  /**
+   * @brief Sets the output density below which non-zero outputs are published to subsequent layers
+   * @param max_density  after each forward pass, if at most <code>max_density</code> of all outputs
+   *                     are non-zero, subsequent layers which read only this layer are handed their
+   *                     indices (see <code>Layer::setActiveInputs</code>); otherwise, outputs are
+   *                     treated as dense. A value of <code>0</code> disables output compaction.
+   * @note  Defaults to <code>DefaultMaxActiveDensity</code> if <code>HasSparseOutputs</code>, and to
+   *        <code>0</code> otherwise
+   */
+  void setSparseOutputs(double max_density);
+
+  /**
+   * @brief Returns the number of non-zero outputs of the last forward pass
+   * @retval -1  if outputs were not compacted (compaction is disabled, or outputs were too dense)
+   */
+  inline SizeType activeOutputCount() const
+  {
+    return active_count_;
+  }
+
   /**
    * @brief Initialize the layer
    */
@@ -57,6 +126,27 @@ public:
    */
   virtual bool forward();
 
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @see   Layer::infer
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const;
+
+  /**
+   * @brief Stateless forward value propagation with layer-level dropout applied to each sample
+   * @see   Layer::sample
+   */
+  virtual bool sample(const ValueType* input,
+                      SizeType input_stride,
+                      ValueType* output,
+                      SizeType output_stride,
+                      SizeType count,
+                      std::uint32_t pass) const;
+
   /**
    * @brief Performs backward error propagation
    * @retval true  if backward-propagation succeeded
@@ -74,8 +164,89 @@ protected:
   void load(InputArchive& ar, VersionType version);
 
 private:
+  /// Masks outputs with a new dropout mask
+  inline void dropout(std::false_type)
+  {}
+
+  /// Masks outputs with a new dropout mask
+  void dropout(std::true_type);
+
+  /// Masks each of several samples with an independent dropout mask
+  inline void dropout(std::false_type, ValueType* output, SizeType stride, SizeType count, std::uint32_t pass) const
+  {}
+
+  /// Masks each of several samples with an independent dropout mask
+  inline void dropout(std::true_type, ValueType* output, SizeType stride, SizeType count, std::uint32_t pass) const
+  {
+    NeuronType<ValueType>::apply(output, Base::output_dimension_, stride, count, mask_seed_, pass);
+  }
+
+  /// Removes dropout scaling from outputs copied into back-propagated error
+  inline void unscale(std::false_type)
+  {}
+
+  /// Removes dropout scaling from outputs copied into back-propagated error
+  void unscale(std::true_type);
+
+  /// Masks back-propagated error with the last dropout mask
+  inline void dropoutError(std::false_type)
+  {}
+
+  /// Masks back-propagated error with the last dropout mask
+  void dropoutError(std::true_type);
+
+  /// Packs derivative bits from layer inputs
+  inline void packDerivatives(std::false_type)
+  {}
+
+  /// Packs derivative bits from layer inputs
+  void packDerivatives(std::true_type);
+
+  /// Computes back-propagated error from layer inputs and outputs
+  void computeDerivatives(std::false_type);
+
+  /// Computes back-propagated error from packed derivative bits
+  void computeDerivatives(std::true_type);
+
+  /**
+   * @brief Lists non-zero outputs, and hands them to subsequent layers which read only this layer
+   * @note  Scanning stops as soon as outputs are found to be too dense
+   */
+  void compactOutputs();
+
+  /**
+   * @brief Hands indices of active outputs to subsequent layers which read only this layer
+   * @param indices  ascending output indices, or NULL if outputs are dense
+   * @param count  number of indices
+   */
+  void publishActiveOutputs(const SizeType* indices, SizeType count);
+
   /// Layer activation units
   std::vector<NeuronType<ValueType>> neurons_;
+
+  /// Training mode flag
+  bool training_;
+
+  /// Last dropout mask (training mode only)
+  aligned::Buffer<ValueType> mask_;
+
+  /// Dropout random stream seed
+  std::uint32_t mask_seed_;
+
+  /// Dropout random stream position
+  std::uint32_t mask_sequence_;
+
+  /// Derivative bits of the last forward pass, 64 units per word (<code>HasDerivativeMask</code> only)
+  std::vector<std::uint64_t> derivative_mask_;
+
+  /// Output density below which non-zero outputs are published (0 if disabled)
+  double max_active_density_;
+
+  /// Indices of non-zero outputs of the last forward pass
+  std::vector<SizeType> active_;
+
+  /// Number of non-zero outputs of the last forward pass (-1 if not compacted)
+  SizeType active_count_;
 };
 }  // namespace layer
 }  // namespace ffnn
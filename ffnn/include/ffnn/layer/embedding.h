@@ -0,0 +1,250 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LAYER_EMBEDDING_H
+#define FFNN_LAYER_EMBEDDING_H
+
+// FFNN
+#include <ffnn/layer/hidden.h>
+#include <ffnn/optimizer/optimizer.h>
+#include <ffnn/optimizer/fwd.h>
+
+namespace ffnn
+{
+namespace layer
+{
+/**
+ * @brief An embedding (lookup table) layer
+ *
+ *        Maps each of its inputs, an integer id in <code>[0, vocabularySize())</code> (encoded as a
+ *        <code>ValueType</code>), to a learned <code>embeddingSize()</code>-vector. Outputs are the
+ *        embeddings of all inputs, concatenated in input order.
+ *
+ *        Forward propagation is a gather of table entries (no product with a one-hot encoding), and
+ *        optimizers accumulate and apply gradients only for the table entries of ids seen since the
+ *        last update.
+ *
+ * @note  Ids are not differentiable, so no error is back-propagated to previous layers
+ * @note  Ids are represented exactly by <code>float</code> up to <code>2^24</code>
+ */
+template<typename ValueType,
+         FFNN_SIZE_TYPE EmbeddingsAtCompileTime = Eigen::Dynamic>
+class Embedding :
+  public Hidden<ValueType>
+{
+public:
+  /// Base type alias
+  using Base = Hidden<ValueType>;
+
+  /// Self type alias
+  using Self = Embedding<ValueType, EmbeddingsAtCompileTime>;
+
+  /// Scalar type standardization
+  typedef ValueType ScalarType;
+
+  /// Size type standardization
+  typedef typename Base::SizeType SizeType;
+
+  /// Offset type standardization
+  typedef typename Base::OffsetType OffsetType;
+
+  /// Embedding vector type standardization
+  typedef Eigen::Matrix<ValueType, EmbeddingsAtCompileTime, 1, Eigen::ColMajor> EmbeddingVector;
+
+  /// Embedding table type standardization; column <code>id</code> holds the embedding of <code>id</code>
+  typedef Eigen::Matrix<ValueType, EmbeddingsAtCompileTime, Eigen::Dynamic, Eigen::ColMajor> TableMatrix;
+
+  /// Layer optimization type standardization
+  typedef optimizer::Optimizer<Self> Optimizer;
+
+  /// A configuration object for an Embedding layer
+  struct Parameters
+  {
+    /// Standard deviation of embeddings on init
+    ScalarType init_weight_std;
+
+    /// Embedding mean on init
+    ScalarType init_weight_mean;
+
+    /**
+     * @brief Setup constructor
+     * @param init_weight_std  Standard deviation of initial embeddings
+     * @param init_weight_mean  Mean of initial embeddings
+     */
+    explicit
+    Parameters(ScalarType init_weight_std = 1e-3,
+               ScalarType init_weight_mean = 0.0);
+  };
+
+  /**
+   * @brief Setup constructor
+   * @param vocabulary_size  number of distinct ids
+   * @param embedding_size  number of values per embedding
+   * @param id_count  number of ids (inputs) looked up per forward pass
+   * @param config  layer configuration struct
+   */
+  explicit
+  Embedding(SizeType vocabulary_size = 0,
+            SizeType embedding_size = EmbeddingsAtCompileTime,
+            SizeType id_count = 1,
+            const Parameters& config = Parameters());
+  virtual ~Embedding();
+
+  /**
+   * @brief Initialize the layer
+   */
+  virtual bool initialize();
+
+  /**
+   * @brief Performs forward value propagation
+   * @retval true  if forward-propagation succeeded
+   * @retval false  if an input is not a valid id
+   */
+  virtual bool forward();
+
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @see   Layer::infer
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const;
+
+  /**
+   * @brief Performs backward error propagation
+   * @retval true  if backward-propagation succeeded
+   * @retval false  otherwise
+   * @warning Does not apply layer weight updates
+   * @warning Will throw if an optimizer has not been associated with this layer
+   * @see setOptimizer
+   */
+  virtual bool backward();
+
+  /**
+   * @brief Applies accumulated layer weight updates computed during optimization
+   * @retval true  if weight update succeeded
+   * @retval false  otherwise
+   * @warning Will throw if an optimizer has not been associated with this layer
+   * @see setOptimizer
+   */
+  virtual bool update();
+
+  /**
+   * @brief Re-seats the embedding table on that of a replica layer
+   * @see   Layer::shareParameters
+   */
+  virtual bool shareParameters(Layer<ValueType>& source);
+
+  /**
+   * @brief Moves gradients accumulated by a replica layer's optimizer into this layer's optimizer
+   * @see   Layer::mergeGradients
+   */
+  virtual bool mergeGradients(Layer<ValueType>& replica);
+
+  /**
+   * @brief Reset embeddings
+   */
+  void reset();
+
+  /**
+   * @brief Overwrites embeddings
+   * @param table  <code>embeddingSize() x vocabularySize()</code> embeddings, one per column
+   * @retval true  if embeddings were set
+   * @retval false  if dimensions do not match
+   */
+  template<typename TableType>
+  bool setParameters(const TableType& table);
+
+  /**
+   * @brief Sets an optimizer used update network weights during back-propagation
+   * @param opt  optimizer to set
+   * @warning <code>backward</code> and <code>update</code> methods are expected to throw if an
+   *          optimizer has not been set explicitly
+   */
+  void setOptimizer(typename Optimizer::Ptr opt);
+
+  /**
+   * @brief Exposes the embedding table
+   * @return embeddings, one per column
+   */
+  inline const aligned::Map<TableMatrix>& getTable() const
+  {
+    return table_;
+  }
+
+  /**
+   * @brief Returns the number of distinct ids
+   */
+  inline SizeType vocabularySize() const
+  {
+    return vocabulary_size_;
+  }
+
+  /**
+   * @brief Returns the number of values per embedding
+   */
+  inline SizeType embeddingSize() const
+  {
+    return embedding_size_;
+  }
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+protected:
+  FFNN_REGISTER_SERIALIZABLE(Embedding)
+
+  /// Save serializer
+  void save(OutputArchive& ar, VersionType version) const;
+
+  /// Load serializer
+  void load(InputArchive& ar, VersionType version);
+
+  FFNN_REGISTER_OPTIMIZER(Embedding, Adam);
+  FFNN_REGISTER_OPTIMIZER(Embedding, GradientDescent);
+
+  /**
+   * @brief Converts an input to a table index
+   * @param value  input value
+   * @retval -1  if <code>value</code> is not a valid id
+   */
+  inline SizeType toId(ValueType value) const
+  {
+    if (!(value >= 0 && value < static_cast<ValueType>(vocabulary_size_)))
+    {
+      return -1;
+    }
+    const SizeType id = static_cast<SizeType>(value);
+    return (static_cast<ValueType>(id) == value) ? id : -1;
+  }
+
+  /// Layer configuration parameters
+  Parameters config_;
+
+  /// Number of distinct ids
+  SizeType vocabulary_size_;
+
+  /// Number of values per embedding
+  SizeType embedding_size_;
+
+  /// Embedding table storage
+  aligned::Buffer<ValueType> table_buffer_;
+
+  /// Embedding table (view of <code>table_buffer_</code>)
+  aligned::Map<TableMatrix> table_;
+
+  /**
+   * @brief Weight optimization resource
+   * @note  This will be the <code>optimizer::None</code> type by default
+   * @see   setOptimizer
+   */
+  typename Optimizer::Ptr opt_;
+};
+}  // namespace layer
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/layer/impl/embedding.hpp>
+#endif  // FFNN_LAYER_EMBEDDING_H
@@ -109,6 +109,25 @@ public:
    */
   virtual bool forward();
 
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @see   Layer::infer
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const;
+
+  /**
+   * @brief Returns the number of weights and biases applied to each sample
+   * @see   Layer::costPerSample
+   */
+  virtual double costPerSample() const
+  {
+    return static_cast<double>(Base::input_dimension_ + 1) * Base::output_dimension_;
+  }
+
   /**
    * @brief Performs backward error propagation
    * @retval true  if backward-propagation succeeded
@@ -128,11 +147,33 @@ public:
    */
   virtual bool update();
 
+  /**
+   * @brief Re-seats weights and biases on those of a replica layer
+   * @see   Layer::shareParameters
+   */
+  virtual bool shareParameters(Layer<ValueType>& source);
+
+  /**
+   * @brief Moves gradients accumulated by a replica layer's optimizer into this layer's optimizer
+   * @see   Layer::mergeGradients
+   */
+  virtual bool mergeGradients(Layer<ValueType>& replica);
+
   /**
    * @brief Reset weights and biases
    */
   void reset();
 
+  /**
+   * @brief Overwrites weights and biases
+   * @param weights  <code>outputSize() x inputSize()</code> connection weights
+   * @param biases  <code>outputSize()</code> biasing weights
+   * @retval true  if weights and biases were set
+   * @retval false  if dimensions do not match
+   */
+  template<typename WeightsType, typename BiasesType>
+  bool setParameters(const WeightsType& weights, const BiasesType& biases);
+
   /**
    * @brief Sets an optimizer used update network weights during back-propagation
    * @param opt  optimizer to set
@@ -145,7 +186,7 @@ public:
    * @brief Exposes internal connection weights
    * @return input-output connection weights
    */
-  inline const WeightMatrix& getWeights() const
+  inline const aligned::Map<WeightMatrix>& getWeights() const
   {
     return w_;
   }
@@ -154,11 +195,13 @@ public:
    * @brief Exposes internal biasing weights
    * @return input-biasing vector
    */
-  inline const BiasVector& getBiases() const
+  inline const aligned::Map<BiasVector>& getBiases() const
   {
     return b_;
   }
 
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
 protected:
   FFNN_REGISTER_SERIALIZABLE(FullyConnected)
 
@@ -168,18 +211,41 @@ protected:
   /// Load serializer
   void load(InputArchive& ar, VersionType version);
 
-private:
+  /**
+   * @brief Inserts zero weight columns for input padding into loaded weights
+   * @retval true  if loaded weights match layer inputs, possibly after padding
+   * @retval false  otherwise
+   * @note  Weights saved before input segments were padded have one column per unpadded input
+   * @see   Layer::unpaddedInputIndices
+   */
+  bool padLoadedWeights();
+
+  /**
+   * @brief Computes weighted + biased inputs
+   * @param[out] y  <code>outputSize()</code> affine outputs
+   * @note  Only the weight columns of active inputs are read when inputs are sparse
+   * @see   Layer::setActiveInputs
+   */
+  template<typename OutputType>
+  void computeAffine(OutputType& y) const;
+
   FFNN_REGISTER_OPTIMIZER(FullyConnected, Adam);
   FFNN_REGISTER_OPTIMIZER(FullyConnected, GradientDescent);
 
   /// Layer configuration parameters
   Parameters config_;
 
-  /// Weight matrix
-  WeightMatrix w_;
+  /// Weight matrix storage
+  aligned::Buffer<ValueType> weight_buffer_;
+
+  /// Weight matrix (view of <code>weight_buffer_</code>)
+  aligned::Map<WeightMatrix> w_;
+
+  /// Bias vector storage
+  aligned::Buffer<ValueType> bias_buffer_;
 
-  /// Bias vector
-  BiasVector b_;
+  /// Bias vector (view of <code>bias_buffer_</code>)
+  aligned::Map<BiasVector> b_;
 
   /**
    * @brief Weight optimization resource
@@ -0,0 +1,132 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LAYER_FULLY_CONNECTED_ACTIVATION_H
+#define FFNN_LAYER_FULLY_CONNECTED_ACTIVATION_H
+
+// C++ Standard Library
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/neuron/neuron.h>
+
+namespace ffnn
+{
+namespace layer
+{
+/**
+ * @brief A fully-connected layer with a fused activation
+ *
+ *        Equivalent to a FullyConnected layer followed by an Activation layer. Activations are
+ *        applied directly after the weighted + biased sum, and activation derivatives are folded
+ *        into the forward error before the weight update and error back-propagation. This avoids
+ *        the intermediate layer buffers and an extra layer pass.
+ *
+ * @note  Uses the same optimizers as the equivalent FullyConnected layer
+ */
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime = Eigen::Dynamic,
+         FFNN_SIZE_TYPE OutputsAtCompileTime = Eigen::Dynamic>
+class FullyConnectedActivation :
+  public FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>
+{
+public:
+  /// Base type alias
+  using Base = FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>;
+
+  /// Scalar type standardization
+  typedef typename Base::ScalarType ScalarType;
+
+  /// Size type standardization
+  typedef typename Base::SizeType SizeType;
+
+  /// Offset type standardization
+  typedef typename Base::OffsetType OffsetType;
+
+  /// Matrix type standardization
+  typedef typename Base::InputVector InputVector;
+
+  /// Matrix type standardization
+  typedef typename Base::OutputVector OutputVector;
+
+  /// Layer configuration type standardization
+  typedef typename Base::Parameters Parameters;
+
+  /**
+   * @brief Setup constructor
+   * @param output_dim  number of outputs from the Hidden
+   * @param config  layer configuration struct
+   */
+  explicit
+  FullyConnectedActivation(SizeType output_dim = OutputsAtCompileTime,
+                           const Parameters& config = Parameters());
+  virtual ~FullyConnectedActivation();
+
+  /**
+   * @brief Initialize the layer
+   */
+  virtual bool initialize();
+
+  /**
+   * @brief Performs forward value propagation
+   * @retval true  if forward-propagation succeeded
+   * @retval false  otherwise
+   */
+  virtual bool forward();
+
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @see   Layer::infer
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const;
+
+  /**
+   * @brief Performs backward error propagation
+   * @retval true  if backward-propagation succeeded
+   * @retval false  otherwise
+   * @warning Does not apply layer weight updates
+   * @warning Will throw if an optimizer has not been associated with this layer
+   * @note  Scales the forward error by activation derivatives in place
+   */
+  virtual bool backward();
+
+  /**
+   * @brief External forward error is not supported, since neuron derivatives are applied to
+   *        the forward error in place
+   * @retval false
+   */
+  virtual bool mapForwardError(ValueType* data)
+  {
+    return false;
+  }
+
+protected:
+  FFNN_REGISTER_SERIALIZABLE(FullyConnectedActivation)
+
+  /// Save serializer
+  void save(OutputArchive& ar, VersionType version) const;
+
+  /// Load serializer
+  void load(InputArchive& ar, VersionType version);
+
+private:
+  /// Layer activation units
+  std::vector<NeuronType<ValueType>> neurons_;
+
+  /// Weighted + biased outputs, before activation
+  OutputVector preactivation_;
+};
+}  // namespace layer
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/layer/impl/fully_connected_activation.hpp>
+#endif  // FFNN_LAYER_FULLY_CONNECTED_ACTIVATION_H
@@ -47,6 +47,15 @@ public:
   /// Hidden output type standardization
   typedef Eigen::Matrix<ValueType, OutputsAtCompileTime, 1, Eigen::ColMajor> OutputVector;
 
+  /// Batch (one sample per column) type standardization
+  typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> BatchMatrix;
+
+  /// Strided batch view type standardization
+  typedef Eigen::Map<BatchMatrix, Eigen::Unaligned, Eigen::OuterStride<>> BatchMap;
+
+  /// Strided constant batch view type standardization
+  typedef Eigen::Map<const BatchMatrix, Eigen::Unaligned, Eigen::OuterStride<>> ConstBatchMap;
+
   /**
    * @brief Setup constructor
    * @param input_dim  number of inputs to the Hidden
@@ -92,6 +101,24 @@ public:
     return true;
   }
 
+  /**
+   * @brief Re-seats the layer input view on external memory
+   * @param data  pointer to aligned external input data, or <code>NULL</code> to restore the
+   *              input storage (see <code>getInputData</code>)
+   * @retval true  if the input view was re-seated
+   * @retval false  if <code>data</code> is not aligned
+   * @warning <code>data</code> must hold at least <code>inputSize()</code> elements and outlive its use
+   */
+  virtual bool mapInput(const ValueType* data);
+
+  /**
+   * @brief Re-seats the forward-error view on external memory
+   * @param data  pointer to aligned external error data
+   * @retval true  if the forward-error view was re-seated
+   * @retval false  if <code>data</code> is not aligned
+   */
+  virtual bool mapForwardError(ValueType* data);
+
 protected:
   FFNN_REGISTER_SERIALIZABLE(Layer)
 
@@ -101,17 +128,23 @@ protected:
   /// Load serializer
   void load(InputArchive& ar, VersionType version);
 
+  /**
+   * @brief Adds errors back-propagated by all but the first subsequent layer to <code>forward_error_</code>
+   * @note  Must be called once per backward pass, before <code>forward_error_</code> is read
+   */
+  void accumulateForwardError();
+
   /// Memory-mapped input vector
-  typename aligned::Map<InputVector>::Ptr input_;
+  aligned::Map<InputVector> input_;
 
   /// Memory-mapped output vector
-  typename aligned::Map<OutputVector>::Ptr output_;
+  aligned::Map<OutputVector> output_;
 
   /// Backward error vector
-  typename aligned::Map<InputVector>::Ptr backward_error_;
+  aligned::Map<InputVector> backward_error_;
 
   /// Output-target error vector
-  typename aligned::Map<OutputVector>::Ptr forward_error_;
+  aligned::Map<OutputVector> forward_error_;
 
 private:
   /**
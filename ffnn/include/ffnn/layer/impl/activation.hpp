@@ -4,8 +4,11 @@
  */
 
 // C++ Standard library
+#include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <functional>
+#include <string>
 
 // FFNN
 #include <ffnn/assert.h>
@@ -20,7 +23,32 @@ namespace layer
 template<typename ValueType,
          template<class> class NeuronType,
          FFNN_SIZE_TYPE SizeAtCompileTime>
-Activation<ValueType, NeuronType, SizeAtCompileTime>::Activation()
+constexpr bool Activation<ValueType, NeuronType, SizeAtCompileTime>::HasDropout;
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+constexpr bool Activation<ValueType, NeuronType, SizeAtCompileTime>::HasSparseOutputs;
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+constexpr bool Activation<ValueType, NeuronType, SizeAtCompileTime>::HasDerivativeMask;
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+constexpr double Activation<ValueType, NeuronType, SizeAtCompileTime>::DefaultMaxActiveDensity;
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+Activation<ValueType, NeuronType, SizeAtCompileTime>::Activation() :
+  training_(true),
+  mask_seed_(0),
+  mask_sequence_(0),
+  max_active_density_(HasSparseOutputs ? DefaultMaxActiveDensity : 0.0),
+  active_count_(-1)
 {}
 
 template<typename ValueType,
@@ -50,6 +78,14 @@ bool Activation<ValueType, NeuronType, SizeAtCompileTime>::initialize()
 
   // Initialize neurons
   neurons_.resize(Base::output_dimension_);
+  active_.resize(Base::output_dimension_);
+  if (HasDerivativeMask)
+  {
+    derivative_mask_.assign((Base::output_dimension_ + 63) / 64, 0);
+  }
+
+  // Give each layer its own dropout stream
+  mask_seed_ = static_cast<std::uint32_t>(std::hash<std::string>()(Base::getID()));
 
   FFNN_DEBUG_NAMED("layer::Activation",
                    "<" <<
@@ -71,8 +107,58 @@ bool Activation<ValueType, NeuronType, SizeAtCompileTime>::forward()
   // Compute neuron outputs
   for (SizeType idx = 0; idx < Base::input_dimension_; idx++)
   {
-    neurons_[idx].fn((*Base::input_)(idx), (*Base::output_)(idx));
+    neurons_[idx].fn(Base::input_(idx), Base::output_(idx));
+  }
+  if (Base::hasBackwardError())
+  {
+    packDerivatives(std::integral_constant<bool, HasDerivativeMask>());
+  }
+  dropout(std::integral_constant<bool, HasDropout>());
+  compactOutputs();
+  Base::broadcastOutputs(Base::output_.data());
+  return true;
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+bool Activation<ValueType, NeuronType, SizeAtCompileTime>::infer(const ValueType* input,
+                                                                 SizeType input_stride,
+                                                                 ValueType* output,
+                                                                 SizeType output_stride,
+                                                                 SizeType count) const
+{
+  FFNN_ASSERT_MSG(Base::initialized_, "Layer is not initialized.");
+
+  // Compute neuron outputs (neuron state is local to this call)
+  NeuronType<ValueType> neuron;
+  for (SizeType col = 0; col < count; col++)
+  {
+    const ValueType* x = input + col * input_stride;
+    ValueType* y = output + col * output_stride;
+    for (SizeType idx = 0; idx < Base::input_dimension_; idx++)
+    {
+      neuron.fn(x[idx], y[idx]);
+    }
+  }
+  return true;
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+bool Activation<ValueType, NeuronType, SizeAtCompileTime>::sample(const ValueType* input,
+                                                                  SizeType input_stride,
+                                                                  ValueType* output,
+                                                                  SizeType output_stride,
+                                                                  SizeType count,
+                                                                  std::uint32_t pass) const
+{
+  if (!infer(input, input_stride, output, output_stride, count))
+  {
+    return false;
   }
+  dropout(std::integral_constant<bool, HasDropout>(), output, output_stride, count, pass);
   return true;
 }
 
@@ -81,18 +167,185 @@ template<typename ValueType,
          FFNN_SIZE_TYPE SizeAtCompileTime>
 bool Activation<ValueType, NeuronType, SizeAtCompileTime>::backward()
 {
-  // Compute neuron derivatives
-  Base::backward_error_->noalias() = *Base::output_;
-  for (SizeType idx = 0; idx < Base::output_dimension_; idx++)
+  // Nothing to do if no previous layer reads back-propagated error
+  if (!Base::hasBackwardError())
   {
-    neurons_[idx].derivative((*Base::input_)(idx), (*Base::backward_error_)(idx));
+    return true;
   }
 
-  // Incorporate error
-  Base::backward_error_->array() *= Base::forward_error_->array();
+  // Sum errors of all subsequent layers
+  Base::accumulateForwardError();
+
+  // Compute neuron derivatives, and incorporate error
+  computeDerivatives(std::integral_constant<bool, HasDerivativeMask>());
+  dropoutError(std::integral_constant<bool, HasDropout>());
   return true;
 }
 
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::packDerivatives(std::true_type)
+{
+  for (std::size_t word = 0; word < derivative_mask_.size(); word++)
+  {
+    const SizeType begin = static_cast<SizeType>(word * 64);
+    const SizeType end = std::min<SizeType>(begin + 64, Base::input_dimension_);
+    std::uint64_t bits = 0;
+    for (SizeType idx = begin; idx < end; idx++)
+    {
+      bits |= static_cast<std::uint64_t>(Base::input_(idx) > 0) << (idx - begin);
+    }
+    derivative_mask_[word] = bits;
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::computeDerivatives(std::false_type)
+{
+  Base::backward_error_.noalias() = Base::output_;
+  unscale(std::integral_constant<bool, HasDropout>());
+  for (SizeType idx = 0; idx < Base::output_dimension_; idx++)
+  {
+    neurons_[idx].derivative(Base::input_(idx), Base::backward_error_(idx));
+  }
+  Base::backward_error_.array() *= Base::forward_error_.array();
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::computeDerivatives(std::true_type)
+{
+  const ValueType positive = NeuronType<ValueType>::slope(true);
+  const ValueType negative = NeuronType<ValueType>::slope(false);
+  for (std::size_t word = 0; word < derivative_mask_.size(); word++)
+  {
+    const SizeType begin = static_cast<SizeType>(word * 64);
+    const SizeType end = std::min<SizeType>(begin + 64, Base::output_dimension_);
+    const std::uint64_t bits = derivative_mask_[word];
+    for (SizeType idx = begin; idx < end; idx++)
+    {
+      const bool active = (bits >> (idx - begin)) & 1;
+      Base::backward_error_(idx) = Base::forward_error_(idx) * (active ? positive : negative);
+    }
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::setTraining(bool training)
+{
+  training_ = training;
+  if (!training_)
+  {
+    mask_.clear();
+    mask_.shrink_to_fit();
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::setSparseOutputs(double max_density)
+{
+  FFNN_ASSERT_MSG(max_density >= 0 && max_density <= 1, "[max_density] should be in the range [0, 1].");
+  max_active_density_ = max_density;
+  if (max_active_density_ <= 0 && active_count_ >= 0)
+  {
+    publishActiveOutputs(NULL, 0);
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::compactOutputs()
+{
+  if (max_active_density_ <= 0)
+  {
+    return;
+  }
+
+  // List non-zero outputs; indices are written unconditionally, so that the loop does not branch on
+  // each output value
+  const SizeType limit = static_cast<SizeType>(max_active_density_ * Base::output_dimension_);
+  SizeType count = 0;
+  for (SizeType idx = 0; idx < Base::output_dimension_ && count <= limit; idx++)
+  {
+    active_[count] = idx;
+    count += static_cast<SizeType>(Base::output_(idx) != 0);
+  }
+
+  // Outputs are dense if there are too many non-zero outputs to skip all others profitably
+  if (count > limit)
+  {
+    publishActiveOutputs(NULL, 0);
+  }
+  else
+  {
+    publishActiveOutputs(active_.data(), count);
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::publishActiveOutputs(const SizeType* indices,
+                                                                                SizeType count)
+{
+  active_count_ = indices ? count : -1;
+  for (const auto& connection : Base::next_)
+  {
+    if (connection.offset == 0 && connection.layer->inputSize() == Base::output_dimension_)
+    {
+      connection.layer->setActiveInputs(indices, count);
+    }
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::dropout(std::true_type)
+{
+  if (!training_)
+  {
+    return;
+  }
+  mask_.resize(Base::output_dimension_);
+  NeuronType<ValueType>::mask(mask_.data(), mask_.size(), mask_seed_, mask_sequence_);
+  Base::output_.array() *= Eigen::Map<const typename Base::OutputVector>(mask_.data(), mask_.size()).array();
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::unscale(std::true_type)
+{
+  // Some derivatives are computed from outputs, which are scaled by dropout
+  if (training_)
+  {
+    Base::backward_error_ /= NeuronType<ValueType>::scale();
+  }
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+void Activation<ValueType, NeuronType, SizeAtCompileTime>::dropoutError(std::true_type)
+{
+  if (!training_)
+  {
+    return;
+  }
+  FFNN_ASSERT_MSG(mask_.size() == Base::output_dimension_, "No dropout mask; run forward() in training mode first.");
+  Base::backward_error_.array() *= Eigen::Map<const typename Base::InputVector>(mask_.data(), mask_.size()).array();
+}
+
 template<typename ValueType,
          template<class> class NeuronType,
          FFNN_SIZE_TYPE SizeAtCompileTime>
@@ -0,0 +1,297 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <cmath>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+#include <ffnn/optimizer/none.h>
+#include <ffnn/internal/signature.h>
+
+namespace ffnn
+{
+namespace layer
+{
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+Embedding<ValueType, EmbeddingsAtCompileTime>::
+Parameters::Parameters(ScalarType init_weight_std, ScalarType init_weight_mean) :
+  init_weight_std(init_weight_std),
+  init_weight_mean(init_weight_mean)
+{
+  FFNN_ASSERT_MSG(init_weight_std > 0, "[init_weight_std] should be positive");
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+Embedding<ValueType, EmbeddingsAtCompileTime>::Embedding(SizeType vocabulary_size,
+                                                         SizeType embedding_size,
+                                                         SizeType id_count,
+                                                         const Parameters& config) :
+  Base(0, id_count * embedding_size),
+  config_(config),
+  vocabulary_size_(vocabulary_size),
+  embedding_size_(embedding_size),
+  opt_(boost::make_shared<typename optimizer::None<Self>>())
+{}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+Embedding<ValueType, EmbeddingsAtCompileTime>::~Embedding()
+{}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::initialize()
+{
+  // Abort if layer is already initialized
+  if (!Base::loaded_ && Base::isInitialized())
+  {
+    FFNN_WARN_NAMED("layer::Embedding", "<" << Base::getID() << "> already initialized.");
+    return false;
+  }
+  else if (!Base::initialize())
+  {
+    return false;
+  }
+
+  // Check that there is one input per looked-up id
+  if (vocabulary_size_ <= 0 || embedding_size_ <= 0)
+  {
+    Base::initialized_ = false;
+    FFNN_ERROR_NAMED("layer::Embedding", "<" << Base::getID() << "> has no embeddings.");
+    return false;
+  }
+  else if (Base::input_dimension_ <= 0 || Base::input_dimension_ * embedding_size_ != Base::output_dimension_)
+  {
+    Base::initialized_ = false;
+    FFNN_ERROR_NAMED("layer::Embedding",
+                     "<" << Base::getID() << "> expected " << Base::output_dimension_ / embedding_size_ <<
+                     " ids, but has " << Base::input_dimension_ << " inputs.");
+    return false;
+  }
+
+  // Initialize embeddings
+  if (!Base::loaded_)
+  {
+    reset();
+  }
+
+  // Setup optimizer
+  if (opt_)
+  {
+    opt_->initialize(*this);
+  }
+
+  FFNN_DEBUG_NAMED("layer::Embedding",
+                   "<" <<
+                   Base::getID() <<
+                   "> initialized as (ids=" <<
+                   Base::input_dimension_ <<
+                   ", vocabulary=" <<
+                   vocabulary_size_ <<
+                   ", embedding=" <<
+                   embedding_size_ <<
+                   ") (optimizer=" <<
+                   opt_->name() <<
+                   ")");
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::forward()
+{
+  if (!opt_->forward(*this))
+  {
+    return false;
+  }
+
+  // Gather embeddings of all ids
+  for (SizeType idx = 0; idx < Base::input_dimension_; idx++)
+  {
+    const SizeType id = toId(Base::input_(idx));
+    if (id < 0)
+    {
+      FFNN_ERROR_NAMED("layer::Embedding", "<" << Base::getID() << "> invalid id: " << Base::input_(idx));
+      return false;
+    }
+    Base::output_.segment(idx * embedding_size_, embedding_size_) = table_.col(id);
+  }
+  Base::broadcastOutputs(Base::output_.data());
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::infer(const ValueType* input,
+                                                          SizeType input_stride,
+                                                          ValueType* output,
+                                                          SizeType output_stride,
+                                                          SizeType count) const
+{
+  FFNN_ASSERT_MSG(Base::initialized_, "Layer is not initialized.");
+  typename Base::BatchMap y(output, Base::output_dimension_, count, Eigen::OuterStride<>(output_stride));
+  const typename Base::ConstBatchMap x(input, Base::input_dimension_, count, Eigen::OuterStride<>(input_stride));
+
+  // Gather embeddings of all ids
+  for (SizeType col = 0; col < count; col++)
+  {
+    for (SizeType idx = 0; idx < Base::input_dimension_; idx++)
+    {
+      const SizeType id = toId(x(idx, col));
+      if (id < 0)
+      {
+        FFNN_ERROR_NAMED("layer::Embedding", "<" << Base::getID() << "> invalid id: " << x(idx, col));
+        return false;
+      }
+      y.col(col).segment(idx * embedding_size_, embedding_size_) = table_.col(id);
+    }
+  }
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::backward()
+{
+  FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+  Base::accumulateForwardError();
+  return opt_->backward(*this);
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::update()
+{
+  FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+  return opt_->update(*this);
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::shareParameters(Layer<ValueType>& source)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+
+  Self* owner = dynamic_cast<Self*>(&source);
+  if (!owner || !owner->table_.isMapped())
+  {
+    FFNN_ERROR_NAMED("layer::Embedding",
+                     "<" << Base::getID() << "> cannot share parameters of <" << source.getID() << ">.");
+    return false;
+  }
+  else if (owner->table_.rows() != table_.rows() || owner->table_.cols() != table_.cols())
+  {
+    FFNN_ERROR_NAMED("layer::Embedding",
+                     "<" << Base::getID() << "> dimensions do not match <" << source.getID() << ">.");
+    return false;
+  }
+  else if (owner == this)
+  {
+    return true;
+  }
+
+  // Release own embeddings and view those of the source layer
+  table_buffer_.clear();
+  table_buffer_.shrink_to_fit();
+  table_.remap(owner->table_.data(), owner->table_.rows(), owner->table_.cols());
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::mergeGradients(Layer<ValueType>& replica)
+{
+  FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+
+  Self* other = dynamic_cast<Self*>(&replica);
+  if (!other || !other->opt_)
+  {
+    FFNN_ERROR_NAMED("layer::Embedding",
+                     "<" << Base::getID() << "> cannot merge gradients of <" << replica.getID() << ">.");
+    return false;
+  }
+  return opt_->merge(*this, *other->opt_);
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+void Embedding<ValueType, EmbeddingsAtCompileTime>::reset()
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+
+  // Set uniformly random embeddings
+  table_buffer_.resize(static_cast<std::size_t>(embedding_size_) * vocabulary_size_);
+  table_.remap(table_buffer_.data(), embedding_size_, vocabulary_size_);
+  table_.setRandom();
+  table_ *= config_.init_weight_std;
+  if (std::abs(config_.init_weight_mean) > 0)
+  {
+    table_.array() += config_.init_weight_mean;
+  }
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+template<typename TableType>
+bool Embedding<ValueType, EmbeddingsAtCompileTime>::setParameters(const TableType& table)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+  if (table.rows() != table_.rows() || table.cols() != table_.cols())
+  {
+    FFNN_ERROR_NAMED("layer::Embedding", "<" << Base::getID() << "> parameter dimensions do not match.");
+    return false;
+  }
+  table_ = table;
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+void Embedding<ValueType, EmbeddingsAtCompileTime>::setOptimizer(typename Optimizer::Ptr opt)
+{
+  FFNN_ASSERT_MSG(opt, "Input optimizer object is an empty resource.");
+  opt_ = opt;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+void Embedding<ValueType, EmbeddingsAtCompileTime>::
+  save(typename Embedding<ValueType, EmbeddingsAtCompileTime>::OutputArchive& ar,
+       typename Embedding<ValueType, EmbeddingsAtCompileTime>::VersionType version) const
+{
+  ffnn::io::signature::apply<Embedding<ValueType, EmbeddingsAtCompileTime>>(ar);
+  Base::save(ar, version);
+
+  // Save configuration parameters
+  ar & config_.init_weight_std;
+  ar & config_.init_weight_mean;
+  ar & vocabulary_size_;
+  ar & embedding_size_;
+
+  // Save embedding table
+  {
+    const TableMatrix table(table_);
+    ar & table;
+  }
+
+  FFNN_DEBUG_NAMED("layer::Embedding", "Saved");
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+void Embedding<ValueType, EmbeddingsAtCompileTime>::
+  load(typename Embedding<ValueType, EmbeddingsAtCompileTime>::InputArchive& ar,
+       typename Embedding<ValueType, EmbeddingsAtCompileTime>::VersionType version)
+{
+  ffnn::io::signature::check<Embedding<ValueType, EmbeddingsAtCompileTime>>(ar);
+  Base::load(ar, version);
+
+  // Load configuration parameters
+  ar & config_.init_weight_std;
+  ar & config_.init_weight_mean;
+  ar & vocabulary_size_;
+  ar & embedding_size_;
+
+  // Load embedding table
+  {
+    TableMatrix table;
+    ar & table;
+    table_buffer_.assign(table.data(), table.data() + table.size());
+    table_.remap(table_buffer_.data(), table.rows(), table.cols());
+  }
+
+  FFNN_DEBUG_NAMED("layer::Embedding", "Loaded");
+}
+}  // namespace layer
+}  // namespace ffnn
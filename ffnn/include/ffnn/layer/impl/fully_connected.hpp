@@ -3,9 +3,13 @@
  * @warn Do not include directly
  */
 
+// C++ Standard Library
+#include <vector>
+
 // FFNN
 #include <ffnn/assert.h>
 #include <ffnn/logging.h>
+#include <ffnn/cpu/kernels.h>
 #include <ffnn/optimizer/none.h>
 #include <ffnn/internal/signature.h>
 
@@ -67,6 +71,11 @@ bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::initi
   {
     reset();
   }
+  else if (!padLoadedWeights())
+  {
+    Base::initialized_ = false;
+    return false;
+  }
 
   // Setup optimizer
   if (opt_)
@@ -98,7 +107,43 @@ bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::forwa
   }
 
   // Compute weighted + biased outputs
-  Base::output_->noalias() = w_ * (*Base::input_) + b_;
+  computeAffine(Base::output_);
+  Base::broadcastOutputs(Base::output_.data());
+  return true;
+}
+
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+template<typename OutputType>
+void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::computeAffine(OutputType& y) const
+{
+  if (Base::hasActiveInputs())
+  {
+    // Skip weight columns of inputs which are zero
+    cpu::gatherAffine(w_, Base::getActiveInputs(), Base::activeInputCount(), Base::input_, b_, y);
+  }
+  else
+  {
+    cpu::affine(w_, Base::input_, b_, y);
+  }
+}
+
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::infer(const ValueType* input,
+                                                                                 SizeType input_stride,
+                                                                                 ValueType* output,
+                                                                                 SizeType output_stride,
+                                                                                 SizeType count) const
+{
+  FFNN_ASSERT_MSG(Base::initialized_, "Layer is not initialized.");
+  typename Base::BatchMap y(output, Base::output_dimension_, count, Eigen::OuterStride<>(output_stride));
+  const typename Base::ConstBatchMap x(input, Base::input_dimension_, count, Eigen::OuterStride<>(input_stride));
+
+  // Compute weighted + biased outputs
+  cpu::batchAffine(w_, x, b_, y);
   return true;
 }
 
@@ -108,6 +153,7 @@ template<typename ValueType,
 bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::backward()
 {
   FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+  Base::accumulateForwardError();
   return opt_->backward(*this);
 }
 
@@ -120,6 +166,58 @@ bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::updat
   return opt_->update(*this);
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::shareParameters(Layer<ValueType>& source)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+
+  Self* owner = dynamic_cast<Self*>(&source);
+  if (!owner || !owner->w_.isMapped())
+  {
+    FFNN_ERROR_NAMED("layer::FullyConnected",
+                     "<" << Base::getID() << "> cannot share parameters of <" << source.getID() << ">.");
+    return false;
+  }
+  else if (owner->w_.rows() != w_.rows() || owner->w_.cols() != w_.cols())
+  {
+    FFNN_ERROR_NAMED("layer::FullyConnected",
+                     "<" << Base::getID() << "> dimensions do not match <" << source.getID() << ">.");
+    return false;
+  }
+  else if (owner == this)
+  {
+    return true;
+  }
+
+  // Release own parameters and view those of the source layer
+  weight_buffer_.clear();
+  weight_buffer_.shrink_to_fit();
+  bias_buffer_.clear();
+  bias_buffer_.shrink_to_fit();
+  w_.remap(owner->w_.data(), owner->w_.rows(), owner->w_.cols());
+  b_.remap(owner->b_.data(), owner->b_.rows());
+  return true;
+}
+
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::mergeGradients(Layer<ValueType>& replica)
+{
+  FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+
+  Self* other = dynamic_cast<Self*>(&replica);
+  if (!other || !other->opt_)
+  {
+    FFNN_ERROR_NAMED("layer::FullyConnected",
+                     "<" << Base::getID() << "> cannot merge gradients of <" << replica.getID() << ">.");
+    return false;
+  }
+  return opt_->merge(*this, *other->opt_);
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -128,7 +226,9 @@ void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::reset
   FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
 
   // Set uniformly random weight matrix + add biases
-  w_.setRandom(Base::output_dimension_, Base::input_dimension_);
+  weight_buffer_.resize(Base::output_dimension_ * Base::input_dimension_);
+  w_.remap(weight_buffer_.data(), Base::output_dimension_, Base::input_dimension_);
+  w_.setRandom();
   w_ *= config_.init_weight_std;
   if (std::abs(config_.init_weight_mean) > 0)
   {
@@ -136,7 +236,9 @@ void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::reset
   }
 
   // Set uniformly random bias matrix + add biases
-  b_.setRandom(Base::output_dimension_, 1);
+  bias_buffer_.resize(Base::output_dimension_);
+  b_.remap(bias_buffer_.data(), Base::output_dimension_);
+  b_.setRandom();
   b_ *= config_.init_bias_std;
   if (std::abs(config_.init_bias_mean) > 0)
   {
@@ -144,6 +246,24 @@ void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::reset
   }
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+template<typename WeightsType, typename BiasesType>
+bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
+  setParameters(const WeightsType& weights, const BiasesType& biases)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+  if (weights.rows() != w_.rows() || weights.cols() != w_.cols() || biases.size() != b_.size())
+  {
+    FFNN_ERROR_NAMED("layer::FullyConnected", "<" << Base::getID() << "> parameter dimensions do not match.");
+    return false;
+  }
+  w_ = weights;
+  b_ = biases;
+  return true;
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -154,6 +274,41 @@ void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
   opt_ = opt;
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::padLoadedWeights()
+{
+  if (w_.rows() == Base::output_dimension_ && w_.cols() == Base::input_dimension_)
+  {
+    return true;
+  }
+
+  // Weights saved before input segments were padded have one column per unpadded input
+  const std::vector<OffsetType> indices = Base::unpaddedInputIndices();
+  if (w_.rows() != Base::output_dimension_ || w_.cols() != static_cast<SizeType>(indices.size()))
+  {
+    FFNN_ERROR_NAMED("layer::FullyConnected",
+                     "<" << Base::getID() << "> loaded weights (" << w_.rows() << "x" << w_.cols() <<
+                     ") do not match layer dimensions (" << Base::output_dimension_ << "x" <<
+                     Base::input_dimension_ << ").");
+    return false;
+  }
+
+  // Insert zero columns for padding
+  WeightMatrix w(WeightMatrix::Zero(Base::output_dimension_, Base::input_dimension_));
+  for (std::size_t col = 0; col < indices.size(); col++)
+  {
+    w.col(indices[col]) = w_.col(col);
+  }
+  weight_buffer_.assign(w.data(), w.data() + w.size());
+  w_.remap(weight_buffer_.data(), w.rows(), w.cols());
+
+  FFNN_WARN_NAMED("layer::FullyConnected",
+                  "<" << Base::getID() << "> converted weights saved with unpadded inputs; save again to update.");
+  return true;
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -171,8 +326,12 @@ void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
   ar & config_.init_bias_mean;
 
   // Save weight/bias matrix
-  ar & w_;
-  ar & b_;
+  {
+    const WeightMatrix w(w_);
+    const BiasVector b(b_);
+    ar & w;
+    ar & b;
+  }
 
   FFNN_DEBUG_NAMED("layer::FullyConnected", "Saved");
 }
@@ -194,8 +353,16 @@ void FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
   ar & config_.init_bias_mean;
 
   // Save weight/bias matrix
-  ar & w_;
-  ar & b_;
+  {
+    WeightMatrix w;
+    BiasVector b;
+    ar & w;
+    ar & b;
+    weight_buffer_.assign(w.data(), w.data() + w.size());
+    w_.remap(weight_buffer_.data(), w.rows(), w.cols());
+    bias_buffer_.assign(b.data(), b.data() + b.size());
+    b_.remap(bias_buffer_.data(), b.rows());
+  }
 
   FFNN_DEBUG_NAMED("layer::FullyConnected", "Loaded");
 }
@@ -0,0 +1,157 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+#include <ffnn/internal/signature.h>
+
+namespace ffnn
+{
+namespace layer
+{
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::
+FullyConnectedActivation(SizeType output_dim, const Parameters& config) :
+  Base(output_dim, config)
+{}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::
+~FullyConnectedActivation()
+{}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::initialize()
+{
+  if (!Base::initialize())
+  {
+    return false;
+  }
+
+  // Initialize neurons and pre-activation storage
+  neurons_.resize(Base::output_dimension_);
+  preactivation_.setZero(Base::output_dimension_, 1);
+
+  FFNN_DEBUG_NAMED("layer::FullyConnectedActivation",
+                   "<" <<
+                   Base::getID() <<
+                   "> initialized with fused activation");
+  return true;
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::forward()
+{
+  if (!Base::opt_->forward(*this))
+  {
+    return false;
+  }
+
+  // Compute weighted + biased outputs
+  Base::computeAffine(preactivation_);
+
+  // Compute neuron outputs while pre-activations are still cache-resident
+  for (SizeType idx = 0; idx < Base::output_dimension_; idx++)
+  {
+    neurons_[idx].fn(preactivation_(idx), Base::output_(idx));
+  }
+  Base::broadcastOutputs(Base::output_.data());
+  return true;
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::
+  infer(const ValueType* input,
+        SizeType input_stride,
+        ValueType* output,
+        SizeType output_stride,
+        SizeType count) const
+{
+  // Compute weighted + biased pre-activations in place
+  if (!Base::infer(input, input_stride, output, output_stride, count))
+  {
+    return false;
+  }
+
+  // Compute neuron outputs (neuron state is local to this call)
+  NeuronType<ValueType> neuron;
+  for (SizeType col = 0; col < count; col++)
+  {
+    ValueType* y = output + col * output_stride;
+    for (SizeType idx = 0; idx < Base::output_dimension_; idx++)
+    {
+      const ValueType preactivation = y[idx];
+      neuron.fn(preactivation, y[idx]);
+    }
+  }
+  return true;
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::backward()
+{
+  FFNN_ASSERT_MSG(Base::opt_, "No optimization resource set.");
+
+  // Sum errors of all subsequent layers
+  Base::accumulateForwardError();
+
+  // Incorporate neuron derivatives into forward error
+  for (SizeType idx = 0; idx < Base::output_dimension_; idx++)
+  {
+    ValueType derivative = Base::output_(idx);
+    neurons_[idx].derivative(preactivation_(idx), derivative);
+    Base::forward_error_(idx) *= derivative;
+  }
+
+  // Compute weight gradients and back-propagated error
+  return Base::opt_->backward(*this);
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+void FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::
+  save(typename FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::OutputArchive& ar,
+       typename FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::VersionType version) const
+{
+  ffnn::io::signature::apply<FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>>(ar);
+  Base::save(ar, version);
+  FFNN_DEBUG_NAMED("layer::FullyConnectedActivation", "Saved");
+}
+
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+void FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::
+  load(typename FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::InputArchive& ar,
+       typename FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>::VersionType version)
+{
+  ffnn::io::signature::check<FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>>(ar);
+  Base::load(ar, version);
+  FFNN_DEBUG_NAMED("layer::FullyConnectedActivation", "Loaded");
+}
+}  // namespace layer
+}  // namespace ffnn
@@ -31,20 +31,69 @@ template<typename ValueType,
 typename Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::OffsetType 
 Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::connectToForwardLayer(const Base& next, OffsetType offset)
 {
-  // Map output of next layer to input buffer
+  const std::size_t idx = Base::addForwardConnection(next, offset);
+  if (idx == 0)
   {
-    ValueType* ptr = const_cast<ValueType*>(next.getInputBuffer().data());
-    output_ = aligned::Map<OutputVector>::create(ptr + offset, Base::output_dimension_);      
+    // Map output of next layer to input buffer
+    {
+      ValueType* ptr = const_cast<ValueType*>(next.getInputData());
+      output_.remap(ptr + offset, Base::output_dimension_);
+    }
+    // Map error of next layer to backward-error buffer
+    {
+      ValueType* ptr = const_cast<ValueType*>(next.getBackwardErrorBuffer().data());
+      forward_error_.remap(ptr + offset, Base::output_dimension_);
+    }
+    // Re-seat views of other subsequent layers which read outputs in place
+    for (std::size_t ndx = 1; ndx < Base::next_.size(); ndx++)
+    {
+      if (Base::next_[ndx].shared)
+      {
+        Base::next_[ndx].layer->mapInput(output_.data());
+      }
+    }
   }
-  // Map error of next layer to backward-error buffer
+  else
   {
-    ValueType* ptr = const_cast<ValueType*>(next.getBackwardErrorBuffer().data());
-    forward_error_ = aligned::Map<OutputVector>::create(ptr + offset, Base::output_dimension_);
+    // Other subsequent layers read outputs in place if outputs are their entire input;
+    // otherwise, outputs are copied into their input after each forward pass
+    auto& connection = Base::next_[idx];
+    connection.shared = (offset == 0) &&
+                        (next.inputSize() == Base::output_dimension_) &&
+                        connection.layer->mapInput(output_.data());
+
+    FFNN_ASSERT_MSG(!next.getBackwardErrorBuffer().empty(), "Subsequent layer does not back-propagate error.");
   }
   // Return next offset after assigning buffer segments
   return offset + Base::output_dimension_;
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+void Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::accumulateForwardError()
+{
+  typedef Eigen::Map<const OutputVector, aligned::MapAlignment> ErrorView;
+
+  // Sum errors of two subsequent layers per pass over forward_error_
+  const auto& next = Base::next_;
+  std::size_t idx = 1;
+  for (; idx + 1 < next.size(); idx += 2)
+  {
+    const ErrorView lhs(next[idx].layer->getBackwardErrorBuffer().data() + next[idx].offset,
+                        Base::output_dimension_);
+    const ErrorView rhs(next[idx + 1].layer->getBackwardErrorBuffer().data() + next[idx + 1].offset,
+                        Base::output_dimension_);
+    forward_error_.noalias() += lhs + rhs;
+  }
+  if (idx < next.size())
+  {
+    const ErrorView error(next[idx].layer->getBackwardErrorBuffer().data() + next[idx].offset,
+                          Base::output_dimension_);
+    forward_error_.noalias() += error;
+  }
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -71,12 +120,13 @@ bool Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::initialize()
     FFNN_DEBUG_NAMED("layer::Hidden", "Creating forward mappings.");
 
     // Create input buffer map
-    input_ = aligned::Map<InputVector>::create(Base::input_buffer_.data(),
-                                             Base::input_dimension_);
+    input_.remap(Base::input_data_, Base::input_dimension_);
 
-    // Create input buffer map
-    backward_error_ = aligned::Map<InputVector>::create(Base::backward_error_buffer_.data(),
-                                                      Base::input_dimension_);
+    // Create backward-error buffer map
+    if (Base::hasBackwardError())
+    {
+      backward_error_.remap(Base::backward_error_buffer_.data(), Base::input_dimension_);
+    }
 
     // Resolve previous layer output buffers
     if (Base::connectInputLayers() == Base::input_dimension_)
@@ -100,6 +150,43 @@ bool Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::initialize()
   return false;
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::mapInput(const ValueType* data)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+
+  // Resolve memory location to map
+  ValueType* ptr = const_cast<ValueType*>(data ? data : Base::input_data_);
+  if (!aligned::isAligned(ptr, aligned::MapAlignment))
+  {
+    FFNN_ERROR_NAMED("layer::Hidden", "<" << Base::getID() << "> cannot map unaligned input.");
+    return false;
+  }
+
+  // Re-seat input view
+  input_.remap(ptr, Base::input_dimension_);
+  return true;
+}
+
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool Hidden<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::mapForwardError(ValueType* data)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+  if (!aligned::isAligned(data, aligned::MapAlignment))
+  {
+    FFNN_ERROR_NAMED("layer::Hidden", "<" << Base::getID() << "> cannot map unaligned forward error.");
+    return false;
+  }
+
+  // Re-seat forward-error view
+  forward_error_.remap(data, Base::output_dimension_);
+  return true;
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -12,7 +12,7 @@ namespace layer
 template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
 Input<ValueType, NetworkInputsAtCompileTime>::Input(const SizeType& network_input_dim) :
   Base(0, network_input_dim),
-  next_ptr_(NULL)
+  sparse_(false)
 {}
 
 template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
@@ -40,10 +40,28 @@ template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
 typename Input<ValueType, NetworkInputsAtCompileTime>::OffsetType
 Input<ValueType, NetworkInputsAtCompileTime>::connectToForwardLayer(const Base& next, OffsetType offset)
 {
-  next_ptr_ = const_cast<ValueType*>(next.getInputBuffer().data());
+  const std::size_t idx = Base::addForwardConnection(next, offset);
+  if (idx == 0)
+  {
+    // Re-seat views of other subsequent layers which read inputs in place
+    for (std::size_t ndx = 1; ndx < Base::next_.size(); ndx++)
+    {
+      if (Base::next_[ndx].shared)
+      {
+        Base::next_[ndx].layer->mapInput(getOutputData());
+      }
+    }
+  }
+  else
+  {
+    // Other subsequent layers read inputs in place if they are their entire input;
+    // otherwise, inputs are also copied into their input storage
+    auto& connection = Base::next_[idx];
+    connection.shared = isSoleInput(connection) && connection.layer->mapInput(getOutputData());
+  }
 
   // Return next offset after assigning buffer segments
-  return this->output_dimension_;
+  return offset + Base::output_dimension_;
 }
 
 
@@ -56,7 +74,132 @@ void Input<ValueType, NetworkInputsAtCompileTime>::operator<<(const NetworkInput
                   "Input data size does not match expected network input size.");
 
   // Copy input data to first network layer
-  std::memcpy(next_ptr_, const_cast<ValueType*>(input.data()), input.size() * sizeof(ValueType));
+  std::memcpy(getOutputData(), const_cast<ValueType*>(input.data()), input.size() * sizeof(ValueType));
+  Base::broadcastOutputs(input.data());
+  if (sparse_)
+  {
+    clearActiveInputs();
+  }
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
+void Input<ValueType, NetworkInputsAtCompileTime>::setSparse(const SizeType* indices,
+                                                             const ValueType* values,
+                                                             SizeType nnz) const
+{
+  FFNN_ASSERT_MSG(!Base::next_.empty(), "Input layer is not connected.");
+  FFNN_ASSERT_MSG(nnz >= 0 && nnz <= Base::output_dimension_, "Too many non-zero inputs.");
+
+  for (const auto& connection : Base::next_)
+  {
+    ValueType* ptr = getOutputData(connection);
+    if (!ptr)
+    {
+      continue;
+    }
+
+    // Zero previous inputs; only those which were set, if they were sparse
+    if (sparse_)
+    {
+      for (const auto idx : active_)
+      {
+        ptr[idx] = 0;
+      }
+    }
+    else
+    {
+      std::memset(ptr, 0, Base::output_dimension_ * sizeof(ValueType));
+    }
+
+    // Scatter current inputs
+    for (SizeType k = 0; k < nnz; k++)
+    {
+      FFNN_ASSERT_MSG(indices[k] >= 0 && indices[k] < Base::output_dimension_, "Input index out of range.");
+      FFNN_ASSERT_MSG(k == 0 || indices[k - 1] < indices[k], "Input indices are not strictly ascending.");
+      ptr[indices[k]] = values[k];
+    }
+  }
+
+  // NOTE: Capacity is reserved so that indices are never NULL, which marks dense inputs
+  active_.reserve(Base::output_dimension_);
+  active_.assign(indices, indices + nnz);
+  sparse_ = true;
+
+  // Subsequent layers which read only this layer may skip all other inputs
+  for (const auto& connection : Base::next_)
+  {
+    if (isSoleInput(connection))
+    {
+      connection.layer->setActiveInputs(active_.data(), nnz);
+    }
+  }
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
+void Input<ValueType, NetworkInputsAtCompileTime>::operator<<(const Eigen::SparseVector<ValueType>& input) const
+{
+  // Check input data size
+  FFNN_ASSERT_MSG(input.size() == Base::output_dimension_,
+                  "Input data size does not match expected network input size.");
+
+  // NOTE: Sparse vectors store non-zero elements by ascending index
+  setSparse(input.innerIndexPtr(), input.valuePtr(), static_cast<SizeType>(input.nonZeros()));
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
+void Input<ValueType, NetworkInputsAtCompileTime>::clearActiveInputs() const
+{
+  for (const auto& connection : Base::next_)
+  {
+    connection.layer->setActiveInputs(NULL, 0);
+  }
+  sparse_ = false;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
+bool Input<ValueType, NetworkInputsAtCompileTime>::bind(const ValueType* data)
+{
+  FFNN_ASSERT_MSG(!Base::next_.empty(), "Input layer is not connected.");
+
+  // External memory can only stand in for the entire input of every subsequent layer
+  for (const auto& connection : Base::next_)
+  {
+    if (!isSoleInput(connection))
+    {
+      FFNN_ERROR_NAMED("layer::Input", "<" << Base::getID() << "> is not the only input of the next layer.");
+      return false;
+    }
+  }
+  for (const auto& connection : Base::next_)
+  {
+    if (!connection.layer->mapInput(data))
+    {
+      return false;
+    }
+  }
+  clearActiveInputs();
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE NetworkInputsAtCompileTime>
+bool Input<ValueType, NetworkInputsAtCompileTime>::unbind()
+{
+  FFNN_ASSERT_MSG(!Base::next_.empty(), "Input layer is not connected.");
+  if (!isSoleInput(Base::next_.front()) || !Base::next_.front().layer->mapInput(NULL))
+  {
+    return false;
+  }
+
+  // Restore views of other subsequent layers which read inputs in place
+  for (std::size_t ndx = 1; ndx < Base::next_.size(); ndx++)
+  {
+    if (Base::next_[ndx].shared && !Base::next_[ndx].layer->mapInput(getOutputData()))
+    {
+      return false;
+    }
+  }
+  clearActiveInputs();
+  return true;
 }
 }  // namespace layer
 }  // namespace ffnn
@@ -3,6 +3,9 @@
  * @warn Do not include directly
  */
 
+// C++ Standard Library
+#include <cstring>
+
 // Boost
 #include <boost/serialization/base_object.hpp>
 
@@ -51,8 +54,13 @@ template<typename ValueType>
 Layer<ValueType>:: Layer(SizeType input_dim, SizeType output_dim) :
   initialized_(false),
   loaded_(false),
+  backward_error_enabled_(true),
+  input_error_enabled_(false),
+  active_inputs_(NULL),
+  active_input_count_(0),
   input_dimension_(input_dim > 0 ? input_dim : 0),
-  output_dimension_(output_dim > 0 ? output_dim : 0)
+  output_dimension_(output_dim > 0 ? output_dim : 0),
+  input_data_(NULL)
 {}
 
 template<typename ValueType>
@@ -69,6 +77,9 @@ bool Layer<ValueType>::initialize()
     return false;
   }
 
+  // Skip error back-propagation when no previous layer will read it
+  backward_error_enabled_ = input_error_enabled_ || previousRequiresError();
+
   // Allocate input/error buffers
   if (input_dimension_ > 0 && input_buffer_.empty() && backward_error_buffer_.empty())
   {
@@ -76,8 +87,12 @@ bool Layer<ValueType>::initialize()
     input_buffer_.resize(input_dimension_, 0);
 
     // Allocate backward error buffer
-    backward_error_buffer_.resize(input_dimension_, 0);
+    if (backward_error_enabled_)
+    {
+      backward_error_buffer_.resize(input_dimension_, 0);
+    }
   }
+  input_data_ = input_buffer_.empty() ? NULL : input_buffer_.data();
 
   // Set initialization flag
   initialized_ = true;
@@ -90,6 +105,37 @@ bool Layer<ValueType>::isInitialized()
   return initialized_;
 }
 
+template<typename ValueType>
+bool Layer<ValueType>::relocateInput(ValueType* data)
+{
+  FFNN_ASSERT_MSG(isInitialized(), "Layer is not initialized.");
+  if (data && !aligned::isAligned(data, aligned::MapAlignment))
+  {
+    FFNN_ERROR_NAMED("layer::Layer", "<" << getID() << "> cannot relocate input to unaligned memory.");
+    return false;
+  }
+
+  // Swap input storage
+  if (data)
+  {
+    input_data_ = data;
+    input_buffer_.clear();
+    input_buffer_.shrink_to_fit();
+  }
+  else
+  {
+    if (input_buffer_.empty())
+    {
+      input_buffer_.resize(input_dimension_, 0);
+    }
+    input_data_ = input_buffer_.data();
+  }
+
+  // Re-seat input view and previous layer output views
+  mapInput(input_data_);
+  return connectInputLayers() == input_dimension_;
+}
+
 template<typename ValueType>
 typename Layer<ValueType>::SizeType Layer<ValueType>::countInputs() const
 {
@@ -104,7 +150,7 @@ typename Layer<ValueType>::SizeType Layer<ValueType>::countInputs() const
     }
     else
     {
-      count += connection.second->output_dimension_;
+      count = aligned::padOffset<ValueType>(count) + connection.second->output_dimension_;
     }
   }
   return count;
@@ -124,12 +170,81 @@ typename Layer<ValueType>::OffsetType Layer<ValueType>::connectInputLayers()
       continue;
     }
 
-    // Connect previous layers to this layer's input
-    offset = connection.second->connectToForwardLayer(*this, offset);
+    // Connect previous layers to this layer's input at the next aligned segment
+    offset = connection.second->connectToForwardLayer(*this, aligned::padOffset<ValueType>(offset));
   }
   return offset;
 }
 
+template<typename ValueType>
+std::vector<typename Layer<ValueType>::OffsetType> Layer<ValueType>::unpaddedInputIndices() const
+{
+  std::vector<OffsetType> indices;
+  OffsetType offset(0);
+  for (const auto& connection : prev_)
+  {
+    if (static_cast<bool>(connection.second))
+    {
+      offset = aligned::padOffset<ValueType>(offset);
+      for (SizeType idx = 0; idx < connection.second->output_dimension_; idx++)
+      {
+        indices.push_back(offset + idx);
+      }
+      offset += connection.second->output_dimension_;
+    }
+  }
+  return indices;
+}
+
+template<typename ValueType>
+std::size_t Layer<ValueType>::addForwardConnection(const Layer<ValueType>& next, OffsetType offset)
+{
+  // Update a known layer (e.g. after its input storage was relocated)
+  for (std::size_t idx = 0; idx < next_.size(); idx++)
+  {
+    if (next_[idx].layer == &next)
+    {
+      next_[idx].offset = offset;
+      return idx;
+    }
+  }
+
+  ForwardConnection connection;
+  connection.layer = const_cast<Layer<ValueType>*>(&next);
+  connection.offset = offset;
+  connection.shared = false;
+  next_.push_back(connection);
+  return next_.size() - 1UL;
+}
+
+template<typename ValueType>
+void Layer<ValueType>::broadcastOutputs(const ValueType* output) const
+{
+  // NOTE: The first subsequent layer holds outputs
+  for (std::size_t idx = 1; idx < next_.size(); idx++)
+  {
+    if (!next_[idx].shared)
+    {
+      ValueType* ptr = const_cast<ValueType*>(next_[idx].layer->getInputData()) + next_[idx].offset;
+      std::memcpy(ptr, output, output_dimension_ * sizeof(ValueType));
+    }
+  }
+}
+
+template<typename ValueType>
+bool Layer<ValueType>::previousRequiresError() const
+{
+  for (const auto& connection : prev_)
+  {
+    // Assume unresolved connections require error
+    if (!static_cast<bool>(connection.second) || connection.second->requiresForwardError())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 template<typename ValueType>
 void Layer<ValueType>::save(typename Layer<ValueType>::OutputArchive& ar,
                             typename Layer<ValueType>::VersionType version) const
@@ -11,7 +11,9 @@ namespace layer
 {
 template<typename ValueType, FFNN_SIZE_TYPE NetworkOutputsAtCompileTime>
 Output<ValueType, NetworkOutputsAtCompileTime>::Output() :
-  Base(NetworkOutputsAtCompileTime, 0)
+  Base(NetworkOutputsAtCompileTime, 0),
+  loss_fn_(boost::make_shared<loss::MeanSquaredError<ValueType>>()),
+  loss_(0)
 {}
 
 template<typename ValueType, FFNN_SIZE_TYPE NetworkOutputsAtCompileTime>
@@ -77,8 +79,8 @@ void Output<ValueType, NetworkOutputsAtCompileTime>::operator>>(NetworkOutputTyp
 
   // Copy output data from last network layer
   std::memcpy(const_cast<ValueType*>(output.data()),
-              const_cast<ValueType*>(Base::input_buffer_.data()),
-              Base::input_buffer_.size() * sizeof(ValueType));
+              const_cast<ValueType*>(Base::input_data_),
+              Base::input_dimension_ * sizeof(ValueType));
 }
 
 template<typename ValueType, FFNN_SIZE_TYPE NetworkOutputsAtCompileTime>
@@ -89,11 +91,24 @@ void Output<ValueType, NetworkOutputsAtCompileTime>::operator<<(const NetworkTar
   FFNN_ASSERT_MSG(target.size() == Base::input_dimension_,
                   "Target object size does not match expected network output size.");
 
-  // Compute network error
-  for (SizeType idx = 0; idx < Base::backward_error_buffer_.size(); idx++)
-  {
-    Base::backward_error_buffer_.data()[idx] = Base::input_buffer_.data()[idx] - target.data()[idx];
-  }
+  // Map network outputs, targets and error
+  typedef typename Loss::BatchMatrix BatchMatrix;
+  const Eigen::Map<const BatchMatrix, aligned::MapAlignment>
+    output(Base::input_data_, Base::input_dimension_, 1);
+  const Eigen::Map<const BatchMatrix>
+    target_map(target.data(), Base::input_dimension_, 1);
+  Eigen::Map<BatchMatrix, aligned::MapAlignment>
+    error(Base::backward_error_buffer_.data(), Base::input_dimension_, 1);
+
+  // Compute network loss and error
+  loss_ = loss_fn_->compute(output, target_map, error);
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE NetworkOutputsAtCompileTime>
+void Output<ValueType, NetworkOutputsAtCompileTime>::setLossFunction(typename Loss::Ptr loss_fn)
+{
+  FFNN_ASSERT_MSG(loss_fn, "Input loss function object is an empty resource.");
+  loss_fn_ = loss_fn;
 }
 }  // namespace layer
 }  // namespace ffnn
@@ -3,9 +3,13 @@
  * @warn Do not include directly
  */
 
+// C++ Standard Library
+#include <vector>
+
 // FFNN
 #include <ffnn/assert.h>
 #include <ffnn/logging.h>
+#include <ffnn/cpu/kernels.h>
 #include <ffnn/optimizer/none.h>
 #include <ffnn/internal/signature.h>
 
@@ -41,6 +45,7 @@ SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
 SparselyConnected(SizeType output_dim, const Parameters& config) :
   Base(0, output_dim),
   config_(config),
+  w_(boost::make_shared<WeightMatrix>()),
   opt_(boost::make_shared<typename optimizer::None<Self>>())
 {}
 
@@ -71,6 +76,11 @@ bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::in
   {
     reset();
   }
+  else if (!padLoadedWeights())
+  {
+    Base::initialized_ = false;
+    return false;
+  }
 
   // Setup optimizer
   if (opt_)
@@ -103,8 +113,27 @@ bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::fo
   }
 
   // Compute weighted outputs
-  Base::output_->noalias() = w_ * (*Base::input_);
-  Base::output_->noalias() += b_;
+  Base::output_.noalias() = (*w_) * Base::input_;
+  Base::output_.noalias() += b_;
+  Base::broadcastOutputs(Base::output_.data());
+  return true;
+}
+
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::infer(const ValueType* input,
+                                                                                    SizeType input_stride,
+                                                                                    ValueType* output,
+                                                                                    SizeType output_stride,
+                                                                                    SizeType count) const
+{
+  FFNN_ASSERT_MSG(Base::initialized_, "Layer is not initialized.");
+  typename Base::BatchMap y(output, Base::output_dimension_, count, Eigen::OuterStride<>(output_stride));
+  const typename Base::ConstBatchMap x(input, Base::input_dimension_, count, Eigen::OuterStride<>(input_stride));
+
+  // Compute weighted + biased outputs
+  cpu::sparseBatchAffine(*w_, x, b_, y);
   return true;
 }
 
@@ -114,6 +143,7 @@ template<typename ValueType,
 bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::backward()
 {
   FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+  Base::accumulateForwardError();
   return opt_->backward(*this);
 }
 
@@ -126,6 +156,59 @@ bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::up
   return opt_->update(*this);
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::shareParameters(Layer<ValueType>& source)
+{
+  FFNN_ASSERT_MSG(Base::isInitialized(), "Layer is not initialized.");
+
+  Self* owner = dynamic_cast<Self*>(&source);
+  if (!owner || !owner->b_.isMapped())
+  {
+    FFNN_ERROR_NAMED("layer::SparselyConnected",
+                     "<" << Base::getID() << "> cannot share parameters of <" << source.getID() << ">.");
+    return false;
+  }
+  else if (owner->w_->rows() != w_->rows() || owner->w_->cols() != w_->cols())
+  {
+    FFNN_ERROR_NAMED("layer::SparselyConnected",
+                     "<" << Base::getID() << "> dimensions do not match <" << source.getID() << ">.");
+    return false;
+  }
+  else if (owner == this)
+  {
+    return true;
+  }
+
+  // Release own parameters and view those of the source layer
+  w_ = owner->w_;
+  bias_buffer_.clear();
+  bias_buffer_.shrink_to_fit();
+  b_.remap(owner->b_.data(), owner->b_.rows());
+
+  // Optimizer states follow the shared sparsity pattern
+  opt_->reset(*this);
+  return true;
+}
+
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::mergeGradients(Layer<ValueType>& replica)
+{
+  FFNN_ASSERT_MSG(opt_, "No optimization resource set.");
+
+  Self* other = dynamic_cast<Self*>(&replica);
+  if (!other || !other->opt_)
+  {
+    FFNN_ERROR_NAMED("layer::SparselyConnected",
+                     "<" << Base::getID() << "> cannot merge gradients of <" << replica.getID() << ">.");
+    return false;
+  }
+  return opt_->merge(*this, *other->opt_);
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -140,7 +223,8 @@ void SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::re
   random.setRandom(Base::output_dimension_, Base::input_dimension_);
 
   // Build weight matrix
-  w_.resize(Base::output_dimension_, Base::input_dimension_);
+  WeightMatrix& w = *w_;
+  w.resize(Base::output_dimension_, Base::input_dimension_);
   for (SizeType idx = 0; idx < Base::output_dimension_; idx++)
   {
     for (SizeType jdx = 0; jdx < Base::input_dimension_; jdx++)
@@ -148,14 +232,18 @@ void SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::re
       const ValueType p = (random(idx, jdx) + 1) / 2;
       if (p < config_.connection_probability)
       {
-        w_.insert(idx, jdx) =
+        w.insert(idx, jdx) =
           config_.init_weight_mean + random(idx, jdx) * config_.init_weight_std;
       }
     }
   }
 
+  w.makeCompressed();
+
   // Set uniformly random bias matrix + add biases
-  b_.setRandom(Base::output_dimension_, 1);
+  bias_buffer_.resize(Base::output_dimension_);
+  b_.remap(bias_buffer_.data(), Base::output_dimension_);
+  b_.setRandom();
   b_ *= config_.init_bias_std;
   if (std::abs(config_.init_bias_mean) > 0)
   {
@@ -168,7 +256,7 @@ template<typename ValueType,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
 void SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::prune(ValueType epsilon)
 {
-  w_.prune(0, epsilon);
+  w_->prune(0, epsilon);
 }
 
 template<typename ValueType,
@@ -181,6 +269,48 @@ void SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
   opt_ = opt;
 }
 
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+bool SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::padLoadedWeights()
+{
+  WeightMatrix& w = *w_;
+  if (w.rows() == Base::output_dimension_ && w.cols() == Base::input_dimension_)
+  {
+    return true;
+  }
+
+  // Weights saved before input segments were padded have one column per unpadded input
+  const std::vector<OffsetType> indices = Base::unpaddedInputIndices();
+  if (w.rows() != Base::output_dimension_ || w.cols() != static_cast<SizeType>(indices.size()))
+  {
+    FFNN_ERROR_NAMED("layer::SparselyConnected",
+                     "<" << Base::getID() << "> loaded weights (" << w.rows() << "x" << w.cols() <<
+                     ") do not match layer dimensions (" << Base::output_dimension_ << "x" <<
+                     Base::input_dimension_ << ").");
+    return false;
+  }
+
+  // Move weights to the columns of padded inputs
+  std::vector<Eigen::Triplet<ValueType>> triplets;
+  triplets.reserve(w.nonZeros());
+  for (std::size_t col = 0; col < indices.size(); col++)
+  {
+    for (typename WeightMatrix::InnerIterator it(w, col); it; ++it)
+    {
+      triplets.emplace_back(it.row(), indices[col], it.value());
+    }
+  }
+  WeightMatrix padded(Base::output_dimension_, Base::input_dimension_);
+  padded.setFromTriplets(triplets.begin(), triplets.end());
+  padded.makeCompressed();
+  w.swap(padded);
+
+  FFNN_WARN_NAMED("layer::SparselyConnected",
+                  "<" << Base::getID() << "> converted weights saved with unpadded inputs; save again to update.");
+  return true;
+}
+
 template<typename ValueType,
          FFNN_SIZE_TYPE InputsAtCompileTime,
          FFNN_SIZE_TYPE OutputsAtCompileTime>
@@ -199,8 +329,11 @@ void SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
   ar & config_.init_bias_mean;
 
   // Save weight/bias matrix
-  ar & w_;
-  ar & b_;
+  {
+    const BiasVector b(b_);
+    ar & *w_;
+    ar & b;
+  }
 
   FFNN_DEBUG_NAMED("layer::SparselyConnected", "Saved");
 }
@@ -223,8 +356,13 @@ void SparselyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>::
   ar & config_.init_bias_mean;
 
   // Save weight/bias matrix
-  ar & w_;
-  ar & b_;
+  {
+    BiasVector b;
+    ar & *w_;
+    ar & b;
+    bias_buffer_.assign(b.data(), b.data() + b.size());
+    b_.remap(bias_buffer_.data(), b.rows());
+  }
 
   FFNN_DEBUG_NAMED("layer::SparselyConnected", "Loaded");
 }
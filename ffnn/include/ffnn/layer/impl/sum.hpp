@@ -0,0 +1,195 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard library
+#include <cstring>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+#include <ffnn/cpu/kernels.h>
+#include <ffnn/internal/signature.h>
+
+namespace ffnn
+{
+namespace layer
+{
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+Sum<ValueType, SizeAtCompileTime>::Sum()
+{}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+Sum<ValueType, SizeAtCompileTime>::~Sum()
+{}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+bool Sum<ValueType, SizeAtCompileTime>::initialize()
+{
+  // Abort if layer is already initialized
+  if (Base::isInitialized())
+  {
+    FFNN_WARN_NAMED("layer::Sum", "<" << Base::getID() << "> already initialized.");
+    return false;
+  }
+
+  // Outputs have the size of every previous layer's outputs
+  const auto& prev = Base::getPreviousLayers();
+  if (prev.empty())
+  {
+    FFNN_ERROR_NAMED("layer::Sum", "<" << Base::getID() << "> has no previous layers.");
+    return false;
+  }
+  Base::output_dimension_ = prev.begin()->second->outputSize();
+  for (const auto& connection : prev)
+  {
+    if (connection.second->outputSize() != Base::output_dimension_)
+    {
+      FFNN_ERROR_NAMED("layer::Sum", "<" << Base::getID() << "> previous layers have different output sizes.");
+      return false;
+    }
+  }
+
+  if (!Base::initialize())
+  {
+    return false;
+  }
+
+  // Resolve input segment offsets (same layout as Layer::connectInputLayers)
+  offsets_.clear();
+  OffsetType offset = 0;
+  for (std::size_t idx = 0; idx < prev.size(); idx++)
+  {
+    offset = aligned::padOffset<ValueType>(offset);
+    offsets_.push_back(offset);
+    offset += Base::output_dimension_;
+  }
+
+  FFNN_DEBUG_NAMED("layer::Sum",
+                   "<" <<
+                   Base::getID() <<
+                   "> initialized as (in=" <<
+                   Base::input_dimension_ <<
+                   ", out=" <<
+                   Base::output_dimension_ <<
+                   ")");
+
+  return offset == Base::input_dimension_;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+template<typename OutputMatrixType, typename SegmentFunction>
+void Sum<ValueType, SizeAtCompileTime>::sum(OutputMatrixType& output, const SegmentFunction& segment) const
+{
+  const std::size_t count = offsets_.size();
+  if (count == 1UL)
+  {
+    output.noalias() = segment(0);
+    return;
+  }
+
+  // Sum two segments per pass over outputs
+  output.noalias() = segment(0) + segment(1);
+  std::size_t idx = 2;
+  for (; idx + 1 < count; idx += 2)
+  {
+    output.noalias() += segment(idx) + segment(idx + 1);
+  }
+  if (idx < count)
+  {
+    output.noalias() += segment(idx);
+  }
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+bool Sum<ValueType, SizeAtCompileTime>::forward()
+{
+  typedef Eigen::Map<const OutputVector, aligned::MapAlignment> SegmentView;
+
+  const ValueType* input = Base::input_.data();
+  sum(Base::output_, [this, input](std::size_t idx)
+  {
+    return SegmentView(input + offsets_[idx], Base::output_dimension_);
+  });
+  Base::broadcastOutputs(Base::output_.data());
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+bool Sum<ValueType, SizeAtCompileTime>::infer(const ValueType* input,
+                                              SizeType input_stride,
+                                              ValueType* output,
+                                              SizeType output_stride,
+                                              SizeType count) const
+{
+  FFNN_ASSERT_MSG(Base::initialized_, "Layer is not initialized.");
+
+  // Copy the first segment of each sample, then accumulate the others with the active kernels
+  const cpu::Kernels<ValueType>& kernels = cpu::kernels<ValueType>();
+  for (SizeType col = 0; col < count; col++)
+  {
+    const ValueType* x = input + col * input_stride;
+    ValueType* y = output + col * output_stride;
+    std::memcpy(y, x + offsets_[0], Base::output_dimension_ * sizeof(ValueType));
+    for (std::size_t idx = 1; idx < offsets_.size(); idx++)
+    {
+      kernels.axpy(ValueType(1), x + offsets_[idx], y, Base::output_dimension_);
+    }
+  }
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+bool Sum<ValueType, SizeAtCompileTime>::backward()
+{
+  // Sum errors of all subsequent layers
+  Base::accumulateForwardError();
+
+  // Hand the same error to all previous layers
+  std::size_t idx = 0;
+  for (const auto& connection : Base::getPreviousLayers())
+  {
+    Layer<ValueType>& prev = *connection.second;
+    const OffsetType offset = offsets_[idx++];
+    if (!prev.requiresForwardError())
+    {
+      continue;
+    }
+
+    // NOTE: Re-seated on every pass, since reconnecting a layer restores its forward-error view
+    if (prev.getNextLayers().size() == 1UL && prev.mapForwardError(Base::forward_error_.data()))
+    {
+      continue;
+    }
+    else if (Base::hasBackwardError())
+    {
+      std::memcpy(Base::backward_error_.data() + offset,
+                  Base::forward_error_.data(),
+                  Base::output_dimension_ * sizeof(ValueType));
+    }
+  }
+  return true;
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+void Sum<ValueType, SizeAtCompileTime>::
+  save(typename Sum<ValueType, SizeAtCompileTime>::OutputArchive& ar,
+       typename Sum<ValueType, SizeAtCompileTime>::VersionType version) const
+{
+  ffnn::io::signature::apply<Sum<ValueType, SizeAtCompileTime>>(ar);
+  Base::save(ar, version);
+  FFNN_DEBUG_NAMED("layer::Sum", "Saved");
+}
+
+template<typename ValueType, FFNN_SIZE_TYPE SizeAtCompileTime>
+void Sum<ValueType, SizeAtCompileTime>::
+  load(typename Sum<ValueType, SizeAtCompileTime>::InputArchive& ar,
+       typename Sum<ValueType, SizeAtCompileTime>::VersionType version)
+{
+  ffnn::io::signature::check<Sum<ValueType, SizeAtCompileTime>>(ar);
+  Base::load(ar, version);
+  FFNN_DEBUG_NAMED("layer::Sum", "Loaded");
+}
+}  // namespace layer
+}  // namespace ffnn
@@ -8,6 +8,10 @@
 // C++ Standard Library
 #include <cstring>
 #include <iostream>
+#include <vector>
+
+// Eigen
+#include <Eigen/SparseCore>
 
 // FFNN
 #include <ffnn/config/global.h>
@@ -59,17 +63,97 @@ public:
   template<typename NetworkInputType>
   void operator<<(const NetworkInputType& input) const;
 
+  /**
+   * @brief Sets sparse network input values; all other inputs are zero
+   * @param indices  strictly ascending indices of non-zero inputs
+   * @param values  values of non-zero inputs
+   * @param nnz  number of non-zero inputs
+   * @note  Subsequent layers which read only this layer are informed of the non-zero inputs, so
+   *        that they may skip all others. Each call costs <code>O(nnz)</code> (plus the number of
+   *        inputs set previously), unless inputs were previously set densely.
+   * @see   Layer::setActiveInputs
+   */
+  void setSparse(const SizeType* indices, const ValueType* values, SizeType nnz) const;
+
+  /**
+   * @brief Sets sparse network input values
+   * @param input  sparse network input data
+   * @see   setSparse
+   */
+  void operator<<(const Eigen::SparseVector<ValueType>& input) const;
+
+  /**
+   * @brief Binds external memory directly as the input of all subsequent layers (zero-copy)
+   * @param data  pointer to first element of aligned, contiguous network input data
+   * @retval true  if input memory was bound
+   * @retval false  if this layer is not the only input of every subsequent layer, or
+   *                <code>data</code> is not aligned
+   * @warning <code>data</code> must outlive all subsequent forward passes, or until <code>unbind</code>
+   * @note  Values set with <code>operator<<</code> are ignored while external memory is bound
+   */
+  bool bind(const ValueType* data);
+
+  /**
+   * @brief Restores the internal input storage of subsequent layers after <code>bind</code>
+   * @retval true  if the internal input buffer was restored
+   * @retval false  otherwise
+   */
+  bool unbind();
+
+  /**
+   * @brief Network inputs do not read back-propagated error
+   * @retval false
+   */
+  bool requiresForwardError() const
+  {
+    return false;
+  }
+
 private:
   /**
    * @brief Maps outputs of this layer to inputs of the next
    * @param next  a subsequent layer
    * @param offset  offset index of a memory location in the input buffer of the next layer
-   * @retval output_dimension_
+   * @retval <code>offset + output_dimension_</code>
    */
   OffsetType connectToForwardLayer(const Base& next, OffsetType offset);
 
-  /// Pointer to first element of next layer
-  ValueType* next_ptr_;
+  /**
+   * @brief Returns true if this layer supplies the entire input of a subsequent layer
+   */
+  inline bool isSoleInput(const typename Base::ForwardConnection& connection) const
+  {
+    return connection.offset == 0 && connection.layer->inputSize() == Base::output_dimension_;
+  }
+
+  /**
+   * @brief Returns the location network inputs are copied to for a subsequent layer
+   * @retval NULL  if the subsequent layer reads inputs in place
+   */
+  inline ValueType* getOutputData(const typename Base::ForwardConnection& connection) const
+  {
+    return (&connection == &Base::next_.front()) ? getOutputData() :
+           connection.shared ? NULL : const_cast<ValueType*>(connection.layer->getInputData()) + connection.offset;
+  }
+
+  /**
+   * @brief Marks inputs of all subsequent layers as dense
+   */
+  void clearActiveInputs() const;
+
+  /**
+   * @brief Returns the location network inputs are copied to
+   */
+  inline ValueType* getOutputData() const
+  {
+    return const_cast<ValueType*>(Base::next_.front().layer->getInputData()) + Base::next_.front().offset;
+  }
+
+  /// Indices of inputs set by the last call to <code>setSparse</code>
+  mutable std::vector<SizeType> active_;
+
+  /// Flags if inputs were last set by <code>setSparse</code>
+  mutable bool sparse_;
 };
 }  // namespace layer
 }  // namespace ffnn
@@ -6,8 +6,13 @@
 #define FFNN_LAYER_LAYER_H
 
 // C++ Standard Library
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <vector>
+
+// Boost
+#include <boost/shared_ptr.hpp>
 
 // FFNN (internal)
 #include <ffnn/internal/traits/serializable.h>
@@ -48,6 +53,21 @@ public:
   /// Offset type standardization
   typedef FFNN_OFFSET_TYPE OffsetType;
 
+  /**
+   * @brief Connection to a subsequent layer which reads this layer's outputs
+   */
+  struct ForwardConnection
+  {
+    /// Subsequent layer
+    Layer* layer;
+
+    /// Offset of this layer's output segment in the input of <code>layer</code>
+    OffsetType offset;
+
+    /// True if <code>layer</code> reads outputs in place, through its input view
+    bool shared;
+  };
+
   /**
    * @brief Setup constructor
    * @param input_dim  number of inputs to the Layer
@@ -98,6 +118,92 @@ public:
     return true;
   }
 
+  /**
+   * @brief Re-seats layer parameters (weights, biases) on the parameters of a replica layer
+   * @param source  initialized layer of the same type and dimensions which owns the parameters
+   * @retval true  if parameters are shared, or if the layer has no parameters
+   * @retval false  otherwise
+   * @note  <code>source</code> must outlive this layer
+   */
+  virtual bool shareParameters(Layer& source)
+  {
+    return true;
+  }
+
+  /**
+   * @brief Moves gradients accumulated by a replica layer into this layer's optimizer
+   * @param replica  initialized layer of the same type and dimensions; its accumulated
+   *                 gradients are cleared
+   * @retval true  if gradients were merged, or if the layer has no parameters
+   * @retval false  otherwise
+   */
+  virtual bool mergeGradients(Layer& replica)
+  {
+    return true;
+  }
+
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @param input  first element of a column-major <code>inputSize() x count</code> block
+   * @param input_stride  distance between consecutive input columns
+   * @param output  first element of a column-major <code>outputSize() x count</code> block
+   * @param output_stride  distance between consecutive output columns
+   * @param count  number of samples (columns)
+   * @retval true  if outputs were computed
+   * @retval false  if the layer does not support stateless forward propagation
+   * @note  Only reads layer parameters, so it may be called concurrently for distinct outputs
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const
+  {
+    return false;
+  }
+
+  /**
+   * @brief Stateless forward value propagation with stochastic regularization applied, as in
+   *        training (i.e. an independent dropout mask for each sample)
+   * @param pass  pass identifier; passes with distinct identifiers draw distinct masks
+   * @see   infer
+   * @note  Layers without stochastic regularization compute the same outputs as <code>infer</code>
+   */
+  virtual bool sample(const ValueType* input,
+                      SizeType input_stride,
+                      ValueType* output,
+                      SizeType output_stride,
+                      SizeType count,
+                      std::uint32_t pass) const
+  {
+    return infer(input, input_stride, output, output_stride, count);
+  }
+
+  /**
+   * @brief Re-seats the layer input view on external memory
+   * @param data  pointer to aligned external input data, or <code>NULL</code> to restore the
+   *              input storage (see <code>getInputData</code>)
+   * @retval true  if the input view was re-seated
+   * @retval false  if the layer does not support external inputs
+   */
+  virtual bool mapInput(const ValueType* data)
+  {
+    return false;
+  }
+
+  /**
+   * @brief Re-seats the forward-error view (error back-propagated to this layer) on external memory
+   * @param data  pointer to aligned memory holding <code>outputSize()</code> error values, which
+   *              subsequent layers fill before this layer's backward pass
+   * @retval true  if the forward-error view was re-seated
+   * @retval false  if the layer does not support external forward error
+   * @note  Reconnecting the layer (e.g. relocating the input of a subsequent layer) restores the view
+   */
+  virtual bool mapForwardError(ValueType* data)
+  {
+    return false;
+  }
+
   /**
    * @brief Exposes raw input buffer
    */
@@ -106,6 +212,44 @@ public:
     return input_buffer_;
   }
 
+  /**
+   * @brief Exposes input storage, which previous layers write their outputs to
+   * @note  Points into the raw input buffer unless relocated
+   * @see   relocateInput
+   */
+  inline const ValueType* getInputData() const
+  {
+    return input_data_;
+  }
+
+  /**
+   * @brief Relocates input storage, and the output views of all previous layers, to external memory
+   * @param data  aligned memory for at least <code>inputSize()</code> values, or <code>NULL</code>
+   *              to restore the raw input buffer
+   * @retval true  if input storage was relocated
+   * @retval false  otherwise
+   * @note  The raw input buffer is released while input storage is relocated
+   */
+  bool relocateInput(ValueType* data);
+
+  /**
+   * @brief Exposes connections to previous layers, keyed by layer ID
+   */
+  inline const std::map<std::string, Ptr>& getPreviousLayers() const
+  {
+    return prev_;
+  }
+
+  /**
+   * @brief Exposes connections to subsequent layers, in order of initialization
+   * @note  Outputs are stored in the input of the first subsequent layer. Other subsequent layers
+   *        read them in place when they are their only input, or receive a copy otherwise.
+   */
+  inline const std::vector<ForwardConnection>& getNextLayers() const
+  {
+    return next_;
+  }
+
   /**
    * @brief Exposes raw bakcward-error buffer
    */
@@ -114,6 +258,81 @@ public:
     return backward_error_buffer_;
   }
 
+  /**
+   * @brief Returns true if back-propagated error is computed by this layer
+   * @note  Resolved during initialization
+   */
+  inline bool hasBackwardError() const
+  {
+    return backward_error_enabled_;
+  }
+
+  /**
+   * @brief Forces back-propagated error computation when all previous layers are network inputs
+   * @param enable  true to compute error w.r.t. network inputs
+   * @warning Must be set before layer initialization
+   */
+  inline void setInputErrorEnabled(bool enable)
+  {
+    input_error_enabled_ = enable;
+  }
+
+  /**
+   * @brief Marks the only inputs which may be non-zero during the next forward pass
+   * @param indices  ascending input indices, or NULL if any input may be non-zero
+   * @param count  number of indices
+   * @note  Set by network inputs which supply sparse values, and by activation layers with mostly-zero
+   *        outputs; layers may then skip all other inputs
+   * @warning <code>indices</code> must remain valid until the next call
+   */
+  inline void setActiveInputs(const SizeType* indices, SizeType count)
+  {
+    active_inputs_ = indices;
+    active_input_count_ = indices ? count : 0;
+  }
+
+  /**
+   * @brief Returns true if only inputs listed by <code>getActiveInputs</code> may be non-zero
+   */
+  inline bool hasActiveInputs() const
+  {
+    return active_inputs_ != NULL;
+  }
+
+  /**
+   * @brief Returns indices of inputs which may be non-zero, or NULL if inputs are dense
+   */
+  inline const SizeType* getActiveInputs() const
+  {
+    return active_inputs_;
+  }
+
+  /**
+   * @brief Returns the number of inputs which may be non-zero, if inputs are sparse
+   */
+  inline SizeType activeInputCount() const
+  {
+    return active_input_count_;
+  }
+
+  /**
+   * @brief Returns true if this layer reads the error back-propagated by subsequent layers
+   */
+  virtual bool requiresForwardError() const
+  {
+    return true;
+  }
+
+  /**
+   * @brief Returns an estimate of the arithmetic cost of propagating one sample through this layer
+   * @note  Defaults to one operation per input and output; layers with parameters account for
+   *        their weights instead
+   */
+  virtual double costPerSample() const
+  {
+    return static_cast<double>(inputSize()) + static_cast<double>(outputSize());
+  }
+
   /**
    * @brief Returns the total number of Layer inputs
    */
@@ -150,25 +369,71 @@ protected:
 
   /**
    * @brief Counts the number of inputs from outputs of previous layers
-   * @return total input count
+   * @return total input count, including padding which keeps each input segment aligned
    */
   SizeType countInputs() const;
 
   /**
    * @brief Connects all previous layer to Layer input
    * @retval <code>input_dimension_</code>
+   * @note  Each previous layer output segment starts on an aligned offset
+   * @see   aligned::padOffset
    */
   OffsetType connectInputLayers();
 
+  /**
+   * @brief Maps inputs of the unpadded input layout, in which input segments were not aligned, to inputs
+   * @return input index of each input of the unpadded layout, in order
+   * @note  Used to convert parameters saved before input segments were padded; single-input layers
+   *        have no padding, so both layouts match
+   */
+  std::vector<OffsetType> unpaddedInputIndices() const;
+
+  /**
+   * @brief Registers (or updates) a subsequent layer
+   * @param next  a subsequent layer
+   * @param offset  offset of this layer's output segment in the input of <code>next</code>
+   * @return index of <code>next</code> in <code>getNextLayers()</code>
+   */
+  std::size_t addForwardConnection(const Layer<ValueType>& next, OffsetType offset);
+
+  /**
+   * @brief Copies outputs into the inputs of subsequent layers which do not read them in place
+   * @param output  first element of this layer's outputs
+   */
+  void broadcastOutputs(const ValueType* output) const;
+
+  /**
+   * @brief Checks if any previous layer reads back-propagated error from this layer
+   * @retval true  if at least one previous layer requires error
+   * @retval false  otherwise
+   */
+  bool previousRequiresError() const;
+
   /// Flags if a layer has been initialized
   bool initialized_;
 
   /// Flags if a layer was loaded from file
   bool loaded_;
 
+  /// Flags if back-propagated error is computed for previous layers
+  bool backward_error_enabled_;
+
+  /// Flags if back-propagated error is computed when only network inputs precede this layer
+  bool input_error_enabled_;
+
+  /// Indices of inputs which may be non-zero; NULL if inputs are dense
+  const SizeType* active_inputs_;
+
+  /// Number of inputs which may be non-zero
+  SizeType active_input_count_;
+
   /// Pointers to previous layers
   std::map<std::string, typename Layer<ValueType>::Ptr> prev_;
 
+  /// Connections to subsequent layers
+  std::vector<ForwardConnection> next_;
+
   /// Total number of input connections
   SizeType input_dimension_;
 
@@ -178,6 +443,9 @@ protected:
   /// Raw input value buffer
   aligned::Buffer<ValueType> input_buffer_;
 
+  /// Input storage; points into <code>input_buffer_</code> unless relocated
+  ValueType* input_data_;
+
   /// Raw bakward error value buffer
   aligned::Buffer<ValueType> backward_error_buffer_;
 };
@@ -8,10 +8,15 @@
 // C++ Standard Library
 #include <iostream>
 
+// Boost
+#include <boost/make_shared.hpp>
+
 // FFNN
 #include <ffnn/config/global.h>
 #include <ffnn/aligned_types.h>
 #include <ffnn/layer/layer.h>
+#include <ffnn/loss/loss.h>
+#include <ffnn/loss/mean_squared_error.h>
 
 namespace ffnn
 {
@@ -35,6 +40,15 @@ public:
   /// Offset type standardization
   typedef typename Base::OffsetType OffsetType;
 
+  /// Network output vector type standardization
+  typedef Eigen::Matrix<ValueType, NetworkOutputsAtCompileTime, 1, Eigen::ColMajor> OutputVector;
+
+  /// Read-only network output view type standardization
+  typedef Eigen::Map<const OutputVector, aligned::MapAlignment> OutputView;
+
+  /// Loss function type standardization
+  typedef loss::Loss<ValueType> Loss;
+
   /**
    * @brief Default constructor
    */
@@ -58,7 +72,17 @@ public:
   void operator>>(NetworkOutputType& output);
 
   /**
-   * @brief Set network output-target value
+   * @brief Exposes network output values in place (zero-copy)
+   * @return read-only view of the output layer input buffer
+   * @warning View contents are overwritten on the next forward pass
+   */
+  inline OutputView getOutputView() const
+  {
+    return OutputView(Base::input_data_, Base::input_dimension_);
+  }
+
+  /**
+   * @brief Set network output-target value and compute the loss gradient (back-propagated error)
    * @param target  network output-target values
    * @note <code>NetworkTargetType</code> must have the following methods
    *       - <code>NetworkTargetType::data()</code> to expose a pointer to a contiguous memory block
@@ -68,12 +92,33 @@ public:
   template<typename NetworkTargetType>
   void operator<<(const NetworkTargetType& target);
 
+  /**
+   * @brief Sets the loss function used to compute network error
+   * @param loss_fn  loss function to set
+   * @note  This will be <code>loss::MeanSquaredError</code> by default
+   */
+  void setLossFunction(typename Loss::Ptr loss_fn);
+
+  /**
+   * @brief Returns the loss value computed for the last output-target
+   */
+  inline ValueType getLoss() const
+  {
+    return loss_;
+  }
+
 private:
   /**
    * @brief Passthrough
    * @note  The Output layer is the terminal layer of a network
    */
   OffsetType connectToForwardLayer(const Base& next, OffsetType offset);
+
+  /// Loss function resource
+  typename Loss::Ptr loss_fn_;
+
+  /// Loss value computed for the last output-target
+  ValueType loss_;
 };
 }  // namespace layer
 }  // namespace ffnn
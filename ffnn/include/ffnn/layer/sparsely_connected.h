@@ -114,6 +114,25 @@ public:
    */
   virtual bool forward();
 
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @see   Layer::infer
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const;
+
+  /**
+   * @brief Returns the number of stored weights and biases applied to each sample
+   * @see   Layer::costPerSample
+   */
+  virtual double costPerSample() const
+  {
+    return static_cast<double>(w_ ? w_->nonZeros() : 0) + Base::output_dimension_;
+  }
+
   /**
    * @brief Performs backward error propagation
    * @retval true  if backward-propagation succeeded
@@ -133,6 +152,20 @@ public:
    */
   virtual bool update();
 
+  /**
+   * @brief Shares weights and biases of a replica layer
+   * @note  Replicas share one weight matrix, so its sparsity pattern must not change
+   *        (see <code>reset</code>, <code>prune</code>) while it is shared
+   * @see   Layer::shareParameters
+   */
+  virtual bool shareParameters(Layer<ValueType>& source);
+
+  /**
+   * @brief Moves gradients accumulated by a replica layer's optimizer into this layer's optimizer
+   * @see   Layer::mergeGradients
+   */
+  virtual bool mergeGradients(Layer<ValueType>& replica);
+
   /**
    * @brief Reset weights and biases
    */
@@ -161,6 +194,15 @@ protected:
   /// Load serializer
   void load(InputArchive& ar, VersionType version);
 
+  /**
+   * @brief Inserts zero weight columns for input padding into loaded weights
+   * @retval true  if loaded weights match layer inputs, possibly after padding
+   * @retval false  otherwise
+   * @note  Weights saved before input segments were padded have one column per unpadded input
+   * @see   Layer::unpaddedInputIndices
+   */
+  bool padLoadedWeights();
+
 private:
   FFNN_REGISTER_OPTIMIZER(SparselyConnected, Adam);
   FFNN_REGISTER_OPTIMIZER(SparselyConnected, GradientDescent);
@@ -168,11 +210,14 @@ private:
   /// Layer configuration parameters
   Parameters config_;
 
-  /// Weight matrix
-  WeightMatrix w_;
+  /// Weight matrix (compressed; shared by replicas)
+  boost::shared_ptr<WeightMatrix> w_;
+
+  /// Bias vector storage
+  aligned::Buffer<ValueType> bias_buffer_;
 
-  /// Bias vector
-  BiasVector b_;
+  /// Bias vector (view of <code>bias_buffer_</code>)
+  aligned::Map<BiasVector> b_;
 
   /**
    * @brief Weight optimization resource
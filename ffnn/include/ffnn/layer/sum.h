@@ -0,0 +1,113 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LAYER_SUM_H
+#define FFNN_LAYER_SUM_H
+
+// C++ Standard Library
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/hidden.h>
+
+namespace ffnn
+{
+namespace layer
+{
+/**
+ * @brief Element-wise sum (merge) of the outputs of all previous layers, e.g. for residual connections
+ *
+ *        All previous layers must have the same number of outputs. Each writes its outputs into its
+ *        own (aligned) segment of this layer's input, as with concatenated inputs; the segments are
+ *        summed two at a time in one pass over the outputs. Batched inference accumulates them one
+ *        sample at a time with the active <code>cpu</code> kernels.
+ *
+ *        The error back-propagated to this layer is the error of every previous layer. Previous
+ *        layers which only feed this layer read it in place (see <code>Layer::mapForwardError</code>);
+ *        others receive a copy in their segment of the backward-error buffer.
+ */
+template<typename ValueType,
+         FFNN_SIZE_TYPE SizeAtCompileTime = Eigen::Dynamic>
+class Sum :
+  public Hidden<ValueType, Eigen::Dynamic, SizeAtCompileTime>
+{
+public:
+  /// Base type alias
+  using Base = Hidden<ValueType, Eigen::Dynamic, SizeAtCompileTime>;
+
+  /// Scalar type standardization
+  typedef typename Base::ScalarType ScalarType;
+
+  /// Size type standardization
+  typedef typename Base::SizeType SizeType;
+
+  /// Offset type standardization
+  typedef typename Base::OffsetType OffsetType;
+
+  /// Output vector type standardization
+  typedef typename Base::OutputVector OutputVector;
+
+  /**
+   * @brief Default constructor
+   */
+  Sum();
+  virtual ~Sum();
+
+  /**
+   * @brief Initialize the layer
+   */
+  virtual bool initialize();
+
+  /**
+   * @brief Forward value propagation
+   * @retval true  if forward-propagation succeeded
+   * @retval false  otherwise
+   */
+  virtual bool forward();
+
+  /**
+   * @brief Stateless (inference) forward value propagation over external memory
+   * @see   Layer::infer
+   */
+  virtual bool infer(const ValueType* input,
+                     SizeType input_stride,
+                     ValueType* output,
+                     SizeType output_stride,
+                     SizeType count) const;
+
+  /**
+   * @brief Performs backward error propagation
+   * @retval true  if backward-propagation succeeded
+   * @retval false  otherwise
+   */
+  virtual bool backward();
+
+protected:
+  FFNN_REGISTER_SERIALIZABLE(Sum)
+
+  /// Save serializer
+  void save(OutputArchive& ar, VersionType version) const;
+
+  /// Load serializer
+  void load(InputArchive& ar, VersionType version);
+
+private:
+  /**
+   * @brief Sums all input segments into outputs
+   * @param[out] output  outputs (one sample per column)
+   * @param segment  returns a view of the input segment of the previous layer at a given position
+   */
+  template<typename OutputMatrixType, typename SegmentFunction>
+  void sum(OutputMatrixType& output, const SegmentFunction& segment) const;
+
+  /// Offset of each previous layer's segment of the input
+  std::vector<OffsetType> offsets_;
+};
+}  // namespace layer
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/layer/impl/sum.hpp>
+#endif  // FFNN_LAYER_SUM_H
@@ -0,0 +1,62 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LOSS_BINARY_CROSS_ENTROPY_H
+#define FFNN_LOSS_BINARY_CROSS_ENTROPY_H
+
+// FFNN
+#include <ffnn/loss/loss.h>
+
+namespace ffnn
+{
+namespace loss
+{
+/**
+ * @brief Binary cross-entropy loss with a fused logistic output
+ *
+ *        Network outputs are treated as logits \f[ z \f] with probabilities
+ *        \f[ p = 1 / (1 + e^{-z}) \f], so no separate logistic activation layer is needed.
+ *        Represents the per-sample loss \f[ L(z, t) = -\sum t \log(p) + (1 - t) \log(1 - p) \f]
+ *        with gradient \f[ p - t \f]
+ *
+ * @note Targets are expected in the range [0, 1]
+ */
+template<typename ValueType>
+class BinaryCrossEntropy :
+  public Loss<ValueType>
+{
+public:
+  /// Base type alias
+  using Base = Loss<ValueType>;
+
+  /**
+   * @brief Computes loss value and loss gradient in a single pass over each sample
+   * @param[in] output  network output logits (one sample per column)
+   * @param[in] target  network output targets (one sample per column)
+   * @param[out] gradient  loss gradient w.r.t. network output logits
+   * @return loss value averaged over all samples
+   */
+  ValueType compute(const typename Base::ConstRef& output,
+                    const typename Base::ConstRef& target,
+                    typename Base::Ref gradient) const
+  {
+    const ValueType scale = static_cast<ValueType>(1) / output.cols();
+    const ValueType one = static_cast<ValueType>(1);
+
+    ValueType loss = 0;
+    for (typename Base::BatchMatrix::Index jdx = 0; jdx < output.cols(); jdx++)
+    {
+      const auto z = output.col(jdx).array();
+      const auto t = target.col(jdx).array();
+
+      // Numerically stable form of the logistic cross-entropy
+      loss += (z.max(static_cast<ValueType>(0)) - z * t + (-z.abs()).exp().log1p()).sum();
+      gradient.col(jdx).array() = scale * ((one + (-z).exp()).inverse() - t);
+    }
+    return scale * loss;
+  }
+};
+}  // namespace loss
+}  // namespace ffnn
+#endif  // FFNN_LOSS_BINARY_CROSS_ENTROPY_H
@@ -0,0 +1,72 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LOSS_HUBER_H
+#define FFNN_LOSS_HUBER_H
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/loss/loss.h>
+
+namespace ffnn
+{
+namespace loss
+{
+/**
+ * @brief Huber loss
+ *
+ *        Quadratic for errors smaller than <code>delta</code> and linear otherwise. The
+ *        gradient is the output error clamped to the range [-delta, delta].
+ */
+template<typename ValueType>
+class Huber :
+  public Loss<ValueType>
+{
+public:
+  /// Base type alias
+  using Base = Loss<ValueType>;
+
+  /**
+   * @brief Setup constructor
+   * @param delta  error magnitude at which the loss becomes linear
+   */
+  explicit
+  Huber(ValueType delta = 1) :
+    delta_(delta)
+  {
+    FFNN_ASSERT_MSG(delta_ > 0, "[delta] should be positive");
+  }
+
+  /**
+   * @brief Computes loss value and loss gradient in a single pass over each sample
+   * @param[in] output  network outputs (one sample per column)
+   * @param[in] target  network output targets (one sample per column)
+   * @param[out] gradient  loss gradient w.r.t. network outputs
+   * @return loss value averaged over all samples
+   */
+  ValueType compute(const typename Base::ConstRef& output,
+                    const typename Base::ConstRef& target,
+                    typename Base::Ref gradient) const
+  {
+    const ValueType scale = static_cast<ValueType>(1) / output.cols();
+    const ValueType half = static_cast<ValueType>(0.5);
+
+    ValueType loss = 0;
+    for (typename Base::BatchMatrix::Index jdx = 0; jdx < output.cols(); jdx++)
+    {
+      auto g = gradient.col(jdx).array();
+      g = output.col(jdx).array() - target.col(jdx).array();
+      loss += (g.abs() <= delta_).select(half * g.square(), delta_ * (g.abs() - half * delta_)).sum();
+      g = scale * g.max(-delta_).min(delta_);
+    }
+    return scale * loss;
+  }
+
+private:
+  /// Error magnitude at which the loss becomes linear
+  const ValueType delta_;
+};
+}  // namespace loss
+}  // namespace ffnn
+#endif  // FFNN_LOSS_HUBER_H
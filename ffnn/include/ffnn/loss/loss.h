@@ -0,0 +1,58 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LOSS_LOSS_H
+#define FFNN_LOSS_LOSS_H
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// FFNN
+#include <ffnn/config/global.h>
+
+namespace ffnn
+{
+namespace loss
+{
+/**
+ * @brief A network loss function
+ *
+ *        Network outputs and targets are arranged column-wise, with one sample per column.
+ *        Loss values are averaged over the batch (column) dimension, and gradients are taken
+ *        with respect to the averaged loss.
+ */
+template<typename ValueType>
+class Loss
+{
+public:
+  /// Shared resource standardization
+  typedef boost::shared_ptr<Loss> Ptr;
+
+  /// Constant shared resource standardization
+  typedef boost::shared_ptr<const Loss> ConstPtr;
+
+  /// Batch matrix type standardization
+  typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> BatchMatrix;
+
+  /// Read-only batch reference type standardization
+  typedef Eigen::Ref<const BatchMatrix> ConstRef;
+
+  /// Writable batch reference type standardization
+  typedef Eigen::Ref<BatchMatrix> Ref;
+
+  virtual ~Loss() {}
+
+  /**
+   * @brief Computes loss value and loss gradient in a single pass over each sample
+   * @param[in] output  network outputs (one sample per column)
+   * @param[in] target  network output targets (one sample per column)
+   * @param[out] gradient  loss gradient w.r.t. network outputs; same size as <code>output</code>
+   * @return loss value averaged over all samples
+   */
+  virtual ValueType compute(const ConstRef& output, const ConstRef& target, Ref gradient) const = 0;
+};
+}  // namespace loss
+}  // namespace ffnn
+#endif  // FFNN_LOSS_LOSS_H
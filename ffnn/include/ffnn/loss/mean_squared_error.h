@@ -0,0 +1,55 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LOSS_MEAN_SQUARED_ERROR_H
+#define FFNN_LOSS_MEAN_SQUARED_ERROR_H
+
+// FFNN
+#include <ffnn/loss/loss.h>
+
+namespace ffnn
+{
+namespace loss
+{
+/**
+ * @brief Squared-error loss
+ *
+ *        Represents the per-sample loss \f[ L(y, t) = \frac{1}{2} \| y - t \|^{2} \f]
+ *        with gradient \f[ y - t \f]
+ */
+template<typename ValueType>
+class MeanSquaredError :
+  public Loss<ValueType>
+{
+public:
+  /// Base type alias
+  using Base = Loss<ValueType>;
+
+  /**
+   * @brief Computes loss value and loss gradient in a single pass over each sample
+   * @param[in] output  network outputs (one sample per column)
+   * @param[in] target  network output targets (one sample per column)
+   * @param[out] gradient  loss gradient w.r.t. network outputs
+   * @return loss value averaged over all samples
+   */
+  ValueType compute(const typename Base::ConstRef& output,
+                    const typename Base::ConstRef& target,
+                    typename Base::Ref gradient) const
+  {
+    const ValueType scale = static_cast<ValueType>(1) / output.cols();
+
+    ValueType loss = 0;
+    for (typename Base::BatchMatrix::Index jdx = 0; jdx < output.cols(); jdx++)
+    {
+      auto g = gradient.col(jdx).array();
+      g = output.col(jdx).array() - target.col(jdx).array();
+      loss += g.square().sum();
+      g *= scale;
+    }
+    return static_cast<ValueType>(0.5) * scale * loss;
+  }
+};
+}  // namespace loss
+}  // namespace ffnn
+#endif  // FFNN_LOSS_MEAN_SQUARED_ERROR_H
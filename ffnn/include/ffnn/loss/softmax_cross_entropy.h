@@ -0,0 +1,71 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_LOSS_SOFTMAX_CROSS_ENTROPY_H
+#define FFNN_LOSS_SOFTMAX_CROSS_ENTROPY_H
+
+// C++ Standard Library
+#include <cmath>
+
+// FFNN
+#include <ffnn/loss/loss.h>
+
+namespace ffnn
+{
+namespace loss
+{
+/**
+ * @brief Categorical cross-entropy loss with a fused softmax output
+ *
+ *        Network outputs are treated as logits \f[ z \f] with class probabilities
+ *        \f[ p = e^{z} / \sum e^{z} \f], so no separate softmax layer (or its Jacobian) is needed.
+ *        Represents the per-sample loss \f[ L(z, t) = -\sum t \log(p) \f]
+ *        with gradient \f[ p - t \f]
+ *
+ * @note Targets are expected to sum to one for each sample
+ */
+template<typename ValueType>
+class SoftmaxCrossEntropy :
+  public Loss<ValueType>
+{
+public:
+  /// Base type alias
+  using Base = Loss<ValueType>;
+
+  /**
+   * @brief Computes loss value and loss gradient in a single pass over each sample
+   * @param[in] output  network output logits (one sample per column)
+   * @param[in] target  network output targets (one sample per column)
+   * @param[out] gradient  loss gradient w.r.t. network output logits
+   * @return loss value averaged over all samples
+   */
+  ValueType compute(const typename Base::ConstRef& output,
+                    const typename Base::ConstRef& target,
+                    typename Base::Ref gradient) const
+  {
+    const ValueType scale = static_cast<ValueType>(1) / output.cols();
+
+    ValueType loss = 0;
+    for (typename Base::BatchMatrix::Index jdx = 0; jdx < output.cols(); jdx++)
+    {
+      const auto z = output.col(jdx).array();
+      const auto t = target.col(jdx).array();
+      auto g = gradient.col(jdx).array();
+
+      // Shifted exponentials (log-sum-exp trick)
+      const ValueType z_max = z.maxCoeff();
+      g = (z - z_max).exp();
+      const ValueType sum = g.sum();
+      const ValueType log_sum = z_max + std::log(sum);
+
+      // Accumulate loss and compute (softmax - target)
+      loss += (t * (log_sum - z)).sum();
+      g = scale * (g / sum - t);
+    }
+    return scale * loss;
+  }
+};
+}  // namespace loss
+}  // namespace ffnn
+#endif  // FFNN_LOSS_SOFTMAX_CROSS_ENTROPY_H
@@ -0,0 +1,170 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_MEMORY_ARENA_RESOURCE_H
+#define FFNN_MEMORY_ARENA_RESOURCE_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// FFNN
+#include <ffnn/memory/resource.h>
+
+namespace ffnn
+{
+namespace memory
+{
+/**
+ * @brief Bump-pointer arena resource
+ *
+ *        Carves allocations out of large blocks taken from an upstream resource, so that
+ *        buffers of a network are packed contiguously. Individual deallocations are no-ops;
+ *        memory is returned to the upstream resource on <code>release</code> or destruction.
+ * @note  Not thread-safe; build and initialize a network from one thread
+ */
+class ArenaResource :
+  public Resource
+{
+public:
+  /**
+   * @brief Setup constructor
+   * @param block_size  size of blocks requested from <code>upstream</code>, in bytes
+   * @param upstream  resource providing arena blocks
+   */
+  explicit
+  ArenaResource(std::size_t block_size = (1UL << 20), Resource* upstream = heapResource()) :
+    block_size_(block_size),
+    upstream_(upstream),
+    head_(0),
+    end_(0),
+    used_(0)
+  {}
+
+  ~ArenaResource()
+  {
+    release();
+  }
+
+  /**
+   * @brief Allocates an aligned block from the arena
+   */
+  void* allocate(std::size_t bytes, std::size_t alignment)
+  {
+    std::uintptr_t ptr = (head_ + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+    if (!head_ || ptr + bytes > end_)
+    {
+      // Start a new block; oversized requests get a dedicated block
+      const std::size_t size = std::max(block_size_, bytes);
+      const std::size_t block_alignment = std::max(alignment, static_cast<std::size_t>(64));
+      blocks_.push_back(Block(upstream_->allocate(size, block_alignment), size, block_alignment));
+      head_ = reinterpret_cast<std::uintptr_t>(blocks_.back().ptr);
+      end_ = head_ + size;
+      ptr = head_;
+    }
+    head_ = ptr + bytes;
+    used_ += bytes;
+    return reinterpret_cast<void*>(ptr);
+  }
+
+  /**
+   * @brief Passthrough; arena memory is reclaimed all at once
+   */
+  void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) {}
+
+  /**
+   * @brief Returns all arena blocks to the upstream resource
+   * @warning Invalidates all buffers allocated from this arena
+   */
+  void release()
+  {
+    for (const auto& block : blocks_)
+    {
+      upstream_->deallocate(block.ptr, block.size, block.alignment);
+    }
+    blocks_.clear();
+    head_ = 0;
+    end_ = 0;
+    used_ = 0;
+  }
+
+  /**
+   * @brief Returns number of bytes handed out since last <code>release</code>
+   */
+  inline std::size_t used() const
+  {
+    return used_;
+  }
+
+  /**
+   * @brief Returns number of bytes reserved from the upstream resource
+   */
+  inline std::size_t reserved() const
+  {
+    std::size_t total = 0;
+    for (const auto& block : blocks_)
+    {
+      total += block.size;
+    }
+    return total;
+  }
+
+  /**
+   * @brief Checks if a memory location lies within one of the arena blocks
+   */
+  inline bool owns(const void* ptr) const
+  {
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(ptr);
+    for (const auto& block : blocks_)
+    {
+      const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(block.ptr);
+      if (addr >= begin && addr < begin + block.size)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  ArenaResource(const ArenaResource&);
+  ArenaResource& operator=(const ArenaResource&);
+
+  /// Upstream block record
+  struct Block
+  {
+    Block(void* ptr, std::size_t size, std::size_t alignment) :
+      ptr(ptr),
+      size(size),
+      alignment(alignment)
+    {}
+
+    void* ptr;
+    std::size_t size;
+    std::size_t alignment;
+  };
+
+  /// Size of blocks requested from upstream resource
+  std::size_t block_size_;
+
+  /// Resource providing arena blocks
+  Resource* upstream_;
+
+  /// Next free address in current block
+  std::uintptr_t head_;
+
+  /// End of current block
+  std::uintptr_t end_;
+
+  /// Bytes handed out
+  std::size_t used_;
+
+  /// Blocks taken from upstream resource
+  std::vector<Block> blocks_;
+};
+}  // namespace memory
+}  // namespace ffnn
+#endif  // FFNN_MEMORY_ARENA_RESOURCE_H
@@ -0,0 +1,252 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_MEMORY_PAGE_RESOURCE_H
+#define FFNN_MEMORY_PAGE_RESOURCE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+
+// Linux
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// FFNN
+#include <ffnn/logging.h>
+#include <ffnn/memory/resource.h>
+
+namespace ffnn
+{
+namespace memory
+{
+/**
+ * @brief Page-mapped resource for large buffers (i.e. weights of big layers)
+ *
+ *        Allocations of at least <code>min_bytes</code> are mapped directly from the OS,
+ *        optionally backed by 2 MB huge pages and placed on a particular NUMA node. Smaller
+ *        allocations are forwarded to an upstream resource.
+ *
+ * @note  On non-Linux hosts all allocations are forwarded to the upstream resource
+ */
+class PageResource :
+  public Resource
+{
+public:
+  /// Huge-page size
+  static constexpr std::size_t HugePageSize = (2UL << 20);
+
+  /// Node selection which places pages on the node of the first-touching CPU
+  static constexpr int LocalNode = -1;
+
+  /**
+   * @brief Huge-page backing modes
+   */
+  enum class HugePages
+  {
+    None,         ///< Regular pages
+    Transparent,  ///< 2 MB aligned mapping, advised for transparent huge pages
+    Explicit      ///< Pre-reserved huge pages (MAP_HUGETLB); falls back to <code>Transparent</code>
+  };
+
+  /**
+   * @brief Setup constructor
+   * @param huge_pages  huge-page backing mode
+   * @param numa_node  NUMA node to place pages on, or <code>LocalNode</code>
+   * @param min_bytes  smallest allocation which is page-mapped
+   * @param upstream  resource for smaller allocations
+   */
+  explicit
+  PageResource(HugePages huge_pages = HugePages::Transparent,
+               int numa_node = LocalNode,
+               std::size_t min_bytes = HugePageSize,
+               Resource* upstream = heapResource()) :
+    huge_pages_(huge_pages),
+    numa_node_(numa_node),
+    min_bytes_(min_bytes),
+    upstream_(upstream)
+  {}
+
+  /**
+   * @brief Maps a page-aligned block, or forwards to upstream resource
+   */
+  void* allocate(std::size_t bytes, std::size_t alignment)
+  {
+#if defined(__linux__)
+    if (bytes >= min_bytes_)
+    {
+      std::size_t length;
+      void* ptr = map(bytes, length);
+      std::lock_guard<std::mutex> lock(mutex_);
+      mapped_[ptr] = length;
+      return ptr;
+    }
+#endif
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  /**
+   * @brief Unmaps a block, or forwards to upstream resource
+   */
+  void deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+  {
+#if defined(__linux__)
+    if (bytes >= min_bytes_)
+    {
+      std::size_t length = 0;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto itr = mapped_.find(ptr);
+        if (itr != mapped_.end())
+        {
+          length = itr->second;
+          mapped_.erase(itr);
+        }
+      }
+      if (length)
+      {
+        ::munmap(ptr, length);
+      }
+      return;
+    }
+#endif
+    upstream_->deallocate(ptr, bytes, alignment);
+  }
+
+private:
+  PageResource(const PageResource&);
+  PageResource& operator=(const PageResource&);
+
+#if defined(__linux__)
+  /**
+   * @brief Maps at least <code>bytes</code> from the OS
+   * @param[out] length  actual mapped length
+   */
+  void* map(std::size_t bytes, std::size_t& length)
+  {
+    const std::size_t huge_length = roundUp(bytes, HugePageSize);
+    void* ptr = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    if (huge_pages_ == HugePages::Explicit)
+    {
+      ptr = ::mmap(NULL, huge_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (ptr != MAP_FAILED)
+      {
+        length = huge_length;
+        place(ptr, length);
+        return ptr;
+      }
+      FFNN_WARN_NAMED("memory::PageResource", "No explicit huge pages available. Using transparent huge pages.");
+    }
+#endif
+
+    if (huge_pages_ == HugePages::None)
+    {
+      length = roundUp(bytes, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+      ptr = ::mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    else
+    {
+      // Over-map and trim so that the block starts on a huge-page boundary
+      const std::size_t padded_length = huge_length + HugePageSize;
+      void* raw = ::mmap(NULL, padded_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (raw != MAP_FAILED)
+      {
+        const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(raw);
+        const std::uintptr_t aligned = roundUp(begin, HugePageSize);
+        if (aligned > begin)
+        {
+          ::munmap(raw, aligned - begin);
+        }
+        if (begin + padded_length > aligned + huge_length)
+        {
+          ::munmap(reinterpret_cast<void*>(aligned + huge_length), begin + padded_length - aligned - huge_length);
+        }
+        ptr = reinterpret_cast<void*>(aligned);
+        length = huge_length;
+#ifdef MADV_HUGEPAGE
+        ::madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+      }
+    }
+
+    if (ptr == MAP_FAILED)
+    {
+      throw std::bad_alloc();
+    }
+    place(ptr, length);
+    return ptr;
+  }
+
+  /**
+   * @brief Applies NUMA placement policy to a mapped (not yet touched) block
+   */
+  void place(void* ptr, std::size_t length)
+  {
+#ifdef SYS_mbind
+    // Memory policy modes (see <numaif.h>)
+    static const int MPOL_PREFERRED_MODE = 1;
+    static const int MPOL_LOCAL_MODE = 4;
+
+    long status;
+    if (numa_node_ == LocalNode)
+    {
+      status = ::syscall(SYS_mbind, ptr, length, MPOL_LOCAL_MODE, NULL, 0UL, 0U);
+    }
+    else
+    {
+      unsigned long mask[4] = {0UL, 0UL, 0UL, 0UL};
+      const std::size_t word_bits = 8UL * sizeof(unsigned long);
+      if (static_cast<std::size_t>(numa_node_) >= 4UL * word_bits)
+      {
+        FFNN_WARN_NAMED("memory::PageResource", "NUMA node " << numa_node_ << " is out of range.");
+        return;
+      }
+      mask[numa_node_ / word_bits] = (1UL << (numa_node_ % word_bits));
+      status = ::syscall(SYS_mbind, ptr, length, MPOL_PREFERRED_MODE, mask, 4UL * word_bits, 0U);
+    }
+
+    if (status != 0)
+    {
+      FFNN_WARN_NAMED("memory::PageResource", "NUMA placement unavailable; using default page placement.");
+    }
+#endif
+  }
+#endif
+
+  /// Rounds <code>value</code> up to a multiple of <code>step</code>
+  template<typename IntType>
+  static inline IntType roundUp(IntType value, std::size_t step)
+  {
+    return ((value + step - 1) / step) * step;
+  }
+
+  /// Huge-page backing mode
+  HugePages huge_pages_;
+
+  /// NUMA node to place pages on
+  int numa_node_;
+
+  /// Smallest allocation which is page-mapped
+  std::size_t min_bytes_;
+
+  /// Resource for smaller allocations
+  Resource* upstream_;
+
+  /// Protects <code>mapped_</code>
+  std::mutex mutex_;
+
+  /// Lengths of active mappings
+  std::map<void*, std::size_t> mapped_;
+};
+}  // namespace memory
+}  // namespace ffnn
+#endif  // FFNN_MEMORY_PAGE_RESOURCE_H
@@ -0,0 +1,153 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_MEMORY_RESOURCE_H
+#define FFNN_MEMORY_RESOURCE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace ffnn
+{
+namespace memory
+{
+/**
+ * @brief Memory allocation policy interface
+ *
+ *        Resources back all <code>aligned::Buffer</code> allocations. A resource must outlive
+ *        every buffer allocated from it.
+ */
+class Resource
+{
+public:
+  virtual ~Resource() {}
+
+  /**
+   * @brief Allocates a block
+   * @param bytes  block size, in bytes
+   * @param alignment  byte boundary of block start (power of two)
+   * @return pointer to block start
+   * @throws std::bad_alloc  if allocation fails
+   */
+  virtual void* allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+  /**
+   * @brief Deallocates a block created with <code>allocate</code>
+   * @param ptr  pointer to block start
+   * @param bytes  block size given to <code>allocate</code>
+   * @param alignment  alignment given to <code>allocate</code>
+   */
+  virtual void deallocate(void* ptr, std::size_t bytes, std::size_t alignment) = 0;
+};
+
+/**
+ * @brief Default resource; aligned blocks from the standard heap
+ */
+class HeapResource :
+  public Resource
+{
+public:
+  /**
+   * @brief Allocates an aligned block
+   * @note  The original (unaligned) block address is stored just before the aligned block
+   */
+  void* allocate(std::size_t bytes, std::size_t alignment)
+  {
+    void* raw = std::malloc(bytes + alignment);
+    if (!raw)
+    {
+      throw std::bad_alloc();
+    }
+    void* ptr = reinterpret_cast<void*>(
+      (reinterpret_cast<std::uintptr_t>(raw) & ~static_cast<std::uintptr_t>(alignment - 1)) + alignment);
+    *(reinterpret_cast<void**>(ptr) - 1) = raw;
+    return ptr;
+  }
+
+  /**
+   * @brief Deallocates a block created with <code>allocate</code>
+   */
+  void deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+  {
+    if (ptr)
+    {
+      std::free(*(reinterpret_cast<void**>(ptr) - 1));
+    }
+  }
+};
+
+/**
+ * @brief Returns the (static) heap resource
+ */
+inline Resource* heapResource()
+{
+  static HeapResource resource;
+  return &resource;
+}
+
+namespace internal
+{
+/// Resource used by buffers newly created on the calling thread
+inline Resource*& currentResource()
+{
+  static thread_local Resource* resource = heapResource();
+  return resource;
+}
+}  // namespace internal
+
+/**
+ * @brief Returns the resource used by buffers newly created on the calling thread
+ */
+inline Resource* getResource()
+{
+  return internal::currentResource();
+}
+
+/**
+ * @brief Sets the resource used by buffers newly created on the calling thread
+ * @param resource  allocation resource; <code>NULL</code> restores the heap resource
+ * @return previous resource
+ * @note  Buffers keep the resource they were created with
+ * @note  Each thread has its own current resource, which is initially the heap resource
+ */
+inline Resource* setResource(Resource* resource)
+{
+  Resource* previous = internal::currentResource();
+  internal::currentResource() = resource ? resource : heapResource();
+  return previous;
+}
+
+/**
+ * @brief Sets the resource used by buffers newly created on the calling thread, for the
+ *        lifetime of this object
+ *
+ *        Layers create their buffers on construction and size them on initialization, so
+ *        a network is placed in a resource by building and initializing it within this scope.
+ */
+class ScopedResource
+{
+public:
+  explicit
+  ScopedResource(Resource* resource) :
+    previous_(setResource(resource))
+  {}
+
+  ~ScopedResource()
+  {
+    setResource(previous_);
+  }
+
+private:
+  ScopedResource(const ScopedResource&);
+  ScopedResource& operator=(const ScopedResource&);
+
+  /// Resource to restore
+  Resource* previous_;
+};
+}  // namespace memory
+}  // namespace ffnn
+#endif  // FFNN_MEMORY_RESOURCE_H
@@ -0,0 +1,108 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_ACTIVATION_PLAN_H
+#define FFNN_NETWORK_ACTIVATION_PLAN_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/config/global.h>
+#include <ffnn/layer/layer.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Inference activation-memory plan
+ *
+ *        Performs liveness analysis over layer input storage (which holds the outputs of
+ *        previous layers) for one forward pass, and packs storage with non-overlapping
+ *        lifetimes into a small set of shared slots. A chain network needs two slots.
+ *
+ *        The input storage of a multi-input layer is planned as one unit, so concatenated
+ *        input segments stay contiguous. Input storage of layers with no subsequent
+ *        layer (i.e. <code>layer::Output</code>) stays live until the end of the pass, and
+ *        storage written by network inputs is live from the start of the pass.
+ *
+ * @warning Inference only: layer inputs are overwritten before back-propagation would read them
+ * @warning Apply before binding external inputs (<code>layer::Input::bind</code>)
+ */
+template<typename ValueType>
+class ActivationPlan
+{
+public:
+  /// Layer type standardization
+  typedef layer::Layer<ValueType> LayerType;
+
+  /// Layer sequence type standardization
+  typedef std::vector<typename LayerType::Ptr> LayerSequence;
+
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  ActivationPlan();
+
+  /**
+   * @brief Restores the raw input buffers of all planned layers
+   */
+  ~ActivationPlan();
+
+  /**
+   * @brief Plans and applies shared input storage
+   * @param layers  initialized layers, in forward-pass order
+   * @retval true  if all layer inputs were relocated
+   * @retval false  otherwise (previous storage is restored)
+   */
+  bool apply(const LayerSequence& layers);
+
+  /**
+   * @brief Restores the raw input buffers of all planned layers and releases slots
+   */
+  void release();
+
+  /**
+   * @brief Returns number of shared storage slots
+   */
+  inline std::size_t slotCount() const
+  {
+    return slots_.size();
+  }
+
+  /**
+   * @brief Returns number of values held by all shared storage slots
+   */
+  std::size_t planned() const;
+
+  /**
+   * @brief Returns number of values which unplanned input storage would hold
+   */
+  inline std::size_t unplanned() const
+  {
+    return unplanned_;
+  }
+
+private:
+  ActivationPlan(const ActivationPlan&);
+  ActivationPlan& operator=(const ActivationPlan&);
+
+  /// Shared storage slots
+  std::vector<aligned::Buffer<ValueType>> slots_;
+
+  /// Layers with relocated input storage
+  LayerSequence planned_layers_;
+
+  /// Values held by unplanned input storage
+  std::size_t unplanned_;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/activation_plan.hpp>
+#endif  // FFNN_NETWORK_ACTIVATION_PLAN_H
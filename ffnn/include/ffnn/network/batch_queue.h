@@ -0,0 +1,173 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_BATCH_QUEUE_H
+#define FFNN_NETWORK_BATCH_QUEUE_H
+
+// C++ Standard Library
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/network/inference_plan.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Micro-batching request queue for single-sample inference
+ *
+ *        Collects single-sample requests submitted from any number of threads, and runs them
+ *        through an <code>InferencePlan</code> as one batched pass once <code>max_batch_size</code>
+ *        requests are waiting, or once the oldest request has waited <code>timeout</code>.
+ *        Each request completes its own future.
+ *
+ * @note  The plan must have one network input and one network output, and must outlive the queue
+ */
+template<typename ValueType>
+class BatchQueue
+{
+public:
+  /// Plan type standardization
+  typedef InferencePlan<ValueType> PlanType;
+
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  /// Sample type standardization
+  typedef Eigen::Matrix<ValueType, Eigen::Dynamic, 1> SampleVector;
+
+  /// Clock type standardization
+  typedef std::chrono::steady_clock Clock;
+
+  /// A configuration object for a BatchQueue
+  struct Parameters
+  {
+    /// Largest number of requests run in one pass
+    SizeType max_batch_size;
+
+    /// Longest time the oldest request waits for a batch to fill
+    std::chrono::microseconds timeout;
+
+    /**
+     * @brief Setup constructor
+     * @param max_batch_size  Largest number of requests run in one pass
+     * @param timeout  Longest time the oldest request waits for a batch to fill
+     */
+    explicit
+    Parameters(SizeType max_batch_size = 32,
+               std::chrono::microseconds timeout = std::chrono::microseconds(500));
+  };
+
+  /// Queue statistics
+  struct Metrics
+  {
+    /// Number of passes run with each batch size (indexed by batch size)
+    std::vector<std::size_t> batch_size_histogram;
+
+    /// Number of requests completed
+    std::size_t requests;
+
+    /// Total time requests spent queued before their pass started
+    std::chrono::microseconds total_queueing_delay;
+
+    /// Longest time a request spent queued before its pass started
+    std::chrono::microseconds max_queueing_delay;
+
+    Metrics();
+
+    /**
+     * @brief Returns number of passes run
+     */
+    std::size_t batches() const;
+
+    /**
+     * @brief Returns average time requests spent queued before their pass started
+     */
+    std::chrono::microseconds meanQueueingDelay() const;
+  };
+
+  /**
+   * @brief Setup constructor; starts the batching thread
+   * @param plan  compiled inference plan
+   * @param config  queue configuration struct
+   */
+  explicit
+  BatchQueue(const PlanType& plan, const Parameters& config = Parameters());
+
+  /**
+   * @brief Completes all queued requests and stops the batching thread
+   */
+  ~BatchQueue();
+
+  /**
+   * @brief Queues a single-sample request
+   * @param input  network input sample
+   * @return future network output sample
+   */
+  std::future<SampleVector> submit(const SampleVector& input);
+
+  /**
+   * @brief Returns a snapshot of queue statistics
+   */
+  Metrics getMetrics() const;
+
+  /**
+   * @brief Clears queue statistics
+   */
+  void resetMetrics();
+
+private:
+  BatchQueue(const BatchQueue&);
+  BatchQueue& operator=(const BatchQueue&);
+
+  /// A queued request
+  struct Request
+  {
+    SampleVector input;
+    std::promise<SampleVector> output;
+    Clock::time_point queued;
+  };
+
+  /// Batching thread loop
+  void run();
+
+  /// Inference plan
+  const PlanType& plan_;
+
+  /// Queue configuration parameters
+  Parameters config_;
+
+  /// Protects all members below
+  mutable std::mutex mutex_;
+
+  /// Signals new requests and shutdown
+  std::condition_variable cv_;
+
+  /// Queued requests, oldest first
+  std::deque<Request> requests_;
+
+  /// Queue statistics
+  Metrics metrics_;
+
+  /// Flags batching thread shutdown
+  bool stopping_;
+
+  /// Batching thread
+  std::thread thread_;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/batch_queue.hpp>
+#endif  // FFNN_NETWORK_BATCH_QUEUE_H
@@ -0,0 +1,161 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_DATA_PARALLEL_H
+#define FFNN_NETWORK_DATA_PARALLEL_H
+
+// C++ Standard Library
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/network/replica.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Synchronous data-parallel trainer
+ *
+ *        Trains K replicas of one network on K threads. Replicas share the parameters (weights,
+ *        biases) of the first replica, and keep private activations and optimizer gradient
+ *        accumulators. Each step splits a mini-batch into K contiguous sample ranges, one per
+ *        replica. Replica gradients are then combined by a pairwise tree reduction into the first
+ *        replica, which applies a single optimizer update.
+ *
+ *        Sample ranges and the reduction tree depend only on K and the batch size, so the summed
+ *        gradient is bit-for-bit reproducible regardless of thread timing.
+ *
+ * @note  Parameterized layers must support <code>Layer::shareParameters</code> and
+ *        <code>Layer::mergeGradients</code> (e.g. <code>layer::FullyConnected</code> with
+ *        <code>optimizer::GradientDescent</code>)
+ */
+template<typename ValueType>
+class DataParallel
+{
+public:
+  /// Layer type standardization
+  typedef layer::Layer<ValueType> LayerType;
+
+  /// Layer sequence type standardization
+  typedef std::vector<typename LayerType::Ptr> LayerSequence;
+
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  /**
+   * @brief Sample loading callback
+   *
+   *        Called with the layers of one replica and a sample index. Used to copy sample inputs
+   *        into network inputs before the forward pass, and sample targets into network
+   *        outputs before the backward pass.
+   */
+  typedef std::function<bool(const LayerSequence&, SizeType)> SampleLoader;
+
+  DataParallel();
+
+  /**
+   * @brief Stops worker threads
+   */
+  ~DataParallel();
+
+  /**
+   * @brief Ties replica parameters together and starts worker threads
+   * @param replicas  identically built networks (layers in forward-pass order), each connected,
+   *                  initialized and given its own optimizer instances; the first replica owns
+   *                  the shared parameters
+   * @retval true  if all replicas were set up
+   * @retval false  otherwise
+   */
+  bool setup(const std::vector<LayerSequence>& replicas);
+
+  /**
+   * @brief Runs one synchronous training step
+   *
+   *        For each sample, runs <code>forward</code> on all layers in order, then
+   *        <code>backward</code> on all layers in reverse order.
+   *
+   * @param count  number of samples in the mini-batch
+   * @param load_inputs  loads sample inputs into a replica
+   * @param load_targets  loads sample targets into a replica
+   * @retval true  if all passes, the gradient reduction and the update succeeded
+   * @retval false  otherwise
+   */
+  bool step(SizeType count, const SampleLoader& load_inputs, const SampleLoader& load_targets);
+
+  /**
+   * @brief Returns number of replicas (and threads)
+   */
+  inline std::size_t replicaCount() const
+  {
+    return replicas_.size();
+  }
+
+private:
+  DataParallel(const DataParallel&);
+  DataParallel& operator=(const DataParallel&);
+
+  /// Per-replica task
+  typedef std::function<bool(std::size_t)> Task;
+
+  /**
+   * @brief Runs a task once for each replica, in parallel, and waits for all to finish
+   * @retval true  if all tasks succeeded
+   * @retval false  otherwise
+   */
+  bool dispatch(const Task& task);
+
+  /**
+   * @brief Worker thread loop
+   * @param replica  replica index
+   * @param generation  task counter value when the thread was started
+   */
+  void run(std::size_t replica, std::size_t generation);
+
+  /// Stops and joins worker threads
+  void stop();
+
+  /// Replica networks
+  std::vector<LayerSequence> replicas_;
+
+  /// Worker threads (replica 0 runs on the calling thread)
+  std::vector<std::thread> threads_;
+
+  /// Protects all members below
+  std::mutex mutex_;
+
+  /// Signals a new task or shutdown
+  std::condition_variable start_cv_;
+
+  /// Signals task completion
+  std::condition_variable done_cv_;
+
+  /// Current task
+  const Task* task_;
+
+  /// Task counter
+  std::size_t generation_;
+
+  /// Number of worker threads still running the current task
+  std::size_t pending_;
+
+  /// Flags that all worker threads succeeded on the current task
+  bool succeeded_;
+
+  /// Flags worker thread shutdown
+  bool stopping_;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/data_parallel.hpp>
+#endif  // FFNN_NETWORK_DATA_PARALLEL_H
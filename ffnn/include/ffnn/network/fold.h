@@ -0,0 +1,42 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_FOLD_H
+#define FFNN_NETWORK_FOLD_H
+
+// C++ Standard Library
+#include <cstddef>
+
+// FFNN
+#include <ffnn/network/graph.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Folds layers which are redundant at inference time (post-training graph pass)
+ *
+ *        - <code>layer::Activation<ValueType, neuron::Linear></code> nodes with one previous node are
+ *          dropped; their subsequent nodes read the outputs of the previous node instead
+ *        - a <code>layer::FullyConnected<ValueType></code> node whose only previous node is another
+ *          <code>layer::FullyConnected<ValueType></code>, which feeds nothing else, is replaced by one
+ *          new layer computing <code>(W2 W1) x + (W2 b1 + b2)</code>, if that takes fewer
+ *          multiply-adds per sample (i.e. <code>out2 * in1 < out1 * (in1 + out2)</code>)
+ *
+ *        Only layers of exactly these (dynamically-sized) types are folded. The original layers
+ *        are not modified; folded layers are new, and only support stateless forward propagation.
+ *
+ * @param[in,out] graph  topology of initialized layers
+ * @return number of removed nodes
+ * @see   network::InferencePlan::Parameters::fold, which also checks folded plan outputs
+ */
+template<typename ValueType>
+std::size_t fold(Graph<ValueType>& graph);
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/fold.hpp>
+#endif  // FFNN_NETWORK_FOLD_H
@@ -0,0 +1,82 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_GRAPH_H
+#define FFNN_NETWORK_GRAPH_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/layer.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Topology of a layer graph, detached from the connections of the layers themselves
+ *
+ *        Graph passes (see <code>network::fold</code>) rewrite this topology without touching
+ *        the original layers, which remain a valid network. A node's layer is only evaluated
+ *        with stateless forward propagation (see <code>layer::Layer::infer</code>), so it need not
+ *        be connected to the layers of its previous nodes.
+ */
+template<typename ValueType>
+class Graph
+{
+public:
+  /// Layer type standardization
+  typedef layer::Layer<ValueType> LayerType;
+
+  /// Layer sequence type standardization
+  typedef std::vector<typename LayerType::Ptr> LayerSequence;
+
+  /**
+   * @brief One layer evaluation
+   */
+  struct Node
+  {
+    /// Evaluated layer
+    typename LayerType::Ptr layer;
+
+    /// Previous nodes, in order of the segments of the concatenated layer input
+    std::vector<std::size_t> prev;
+  };
+
+  /**
+   * @brief Resolves the topology of a layer graph
+   * @param layers  initialized layers, in forward-pass order
+   * @retval true  if every previous layer precedes its subsequent layers in <code>layers</code>
+   * @retval false  otherwise
+   */
+  bool build(const LayerSequence& layers);
+
+  /**
+   * @brief Resolves subsequent nodes of each node
+   */
+  std::vector<std::vector<std::size_t>> next() const;
+
+  /**
+   * @brief Removes nodes, and re-numbers all remaining nodes
+   * @param removed  flags nodes to remove; removed nodes must not precede remaining nodes
+   */
+  void remove(const std::vector<bool>& removed);
+
+  /**
+   * @brief Returns layers of all nodes, in forward-pass order
+   */
+  LayerSequence layers() const;
+
+  /// Nodes, in forward-pass order
+  std::vector<Node> nodes;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/graph.hpp>
+#endif  // FFNN_NETWORK_GRAPH_H
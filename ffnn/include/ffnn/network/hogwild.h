@@ -0,0 +1,127 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_HOGWILD_H
+#define FFNN_NETWORK_HOGWILD_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/network/replica.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Lock-free asynchronous (Hogwild) trainer
+ *
+ *        Trains K replicas of one network on K threads. Replicas share the parameters (weights,
+ *        biases) of the first replica, and keep private activations and optimizer gradient
+ *        accumulators. Threads claim mini-batches of samples from a shared counter, and each
+ *        thread applies its own optimizer updates directly to the shared parameters, without
+ *        synchronizing with other threads.
+ *
+ * @warning Parameter updates are plain (racy) read-modify-write operations. Updates from
+ *          concurrent threads may be lost or read part-way through, which stochastic gradient
+ *          descent tolerates when updates are small and, ideally, sparse
+ *          (e.g. <code>layer::SparselyConnected</code> with sparse inputs only writes weights of
+ *          non-zero inputs). Training results are not reproducible between runs.
+ *
+ * @note  Parameterized layers must support <code>Layer::shareParameters</code>
+ */
+template<typename ValueType>
+class Hogwild
+{
+public:
+  /// Layer type standardization
+  typedef layer::Layer<ValueType> LayerType;
+
+  /// Layer sequence type standardization
+  typedef std::vector<typename LayerType::Ptr> LayerSequence;
+
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  /**
+   * @brief Sample loading callback
+   *
+   *        Called with the layers of one replica and a sample index. Used to copy sample inputs
+   *        into network inputs before the forward pass, and sample targets into network
+   *        outputs before the backward pass. Called concurrently for distinct replicas.
+   */
+  typedef std::function<bool(const LayerSequence&, SizeType)> SampleLoader;
+
+  /// A configuration object for a Hogwild trainer
+  struct Parameters
+  {
+    /// Number of samples a thread accumulates between parameter updates
+    SizeType batch_size;
+
+    /**
+     * @brief Setup constructor
+     * @param batch_size  Number of samples a thread accumulates between parameter updates
+     */
+    explicit
+    Parameters(SizeType batch_size = 1);
+  };
+
+  /**
+   * @brief Setup constructor
+   * @param config  trainer configuration struct
+   */
+  explicit
+  Hogwild(const Parameters& config = Parameters());
+
+  /**
+   * @brief Ties replica parameters together
+   * @param replicas  identically built networks (layers in forward-pass order), each connected,
+   *                  initialized and given its own optimizer instances; the first replica owns
+   *                  the shared parameters
+   * @retval true  if all replicas were set up
+   * @retval false  otherwise
+   */
+  bool setup(const std::vector<LayerSequence>& replicas);
+
+  /**
+   * @brief Runs one asynchronous training pass over a set of samples
+   *
+   *        For each sample, runs <code>forward</code> on all layers in order, then
+   *        <code>backward</code> on all layers in reverse order. Runs <code>update</code> on all
+   *        layers after each mini-batch.
+   *
+   * @param count  number of samples
+   * @param load_inputs  loads sample inputs into a replica
+   * @param load_targets  loads sample targets into a replica
+   * @retval true  if all passes and updates succeeded
+   * @retval false  otherwise
+   */
+  bool run(SizeType count, const SampleLoader& load_inputs, const SampleLoader& load_targets);
+
+  /**
+   * @brief Returns number of replicas (and threads)
+   */
+  inline std::size_t replicaCount() const
+  {
+    return replicas_.size();
+  }
+
+private:
+  /// Trainer configuration parameters
+  Parameters config_;
+
+  /// Replica networks
+  std::vector<LayerSequence> replicas_;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/hogwild.hpp>
+#endif  // FFNN_NETWORK_HOGWILD_H
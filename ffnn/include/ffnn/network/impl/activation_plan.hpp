@@ -0,0 +1,199 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+ActivationPlan<ValueType>::ActivationPlan() :
+  unplanned_(0)
+{}
+
+template<typename ValueType>
+ActivationPlan<ValueType>::~ActivationPlan()
+{
+  release();
+}
+
+template<typename ValueType>
+bool ActivationPlan<ValueType>::apply(const LayerSequence& layers)
+{
+  release();
+
+  // Resolve forward-pass position of each layer
+  std::map<std::string, std::size_t> position;
+  for (std::size_t idx = 0; idx < layers.size(); idx++)
+  {
+    FFNN_ASSERT_MSG(layers[idx]->isInitialized(), "Layer is not initialized.");
+    position[layers[idx]->getID()] = idx;
+  }
+
+  // Resolve the last layer which reads the outputs of each layer
+  std::vector<std::size_t> last_read(layers.size(), 0);
+  for (std::size_t idx = 0; idx < layers.size(); idx++)
+  {
+    for (const auto& connection : layers[idx]->getPreviousLayers())
+    {
+      auto itr = position.find(connection.first);
+      if (itr != position.end())
+      {
+        last_read[itr->second] = std::max(last_read[itr->second], idx);
+      }
+    }
+  }
+
+  // Resolve live range of each layer's input storage: from the first write by a previous
+  // layer to the read by its owner (or the end of the pass, if nothing reads its outputs).
+  // Outputs which feed several layers may be read in place from any of their input storages,
+  // so those storages live until the last of these layers.
+  struct LiveRange
+  {
+    std::size_t layer;
+    std::size_t first;
+    std::size_t last;
+    std::size_t slot;
+  };
+
+  std::vector<bool> has_next(layers.size(), false);
+  std::vector<LiveRange> ranges;
+  for (std::size_t idx = 0; idx < layers.size(); idx++)
+  {
+    if (layers[idx]->inputSize() == 0)
+    {
+      continue;
+    }
+
+    LiveRange range = {idx, idx, idx, 0};
+    for (const auto& connection : layers[idx]->getPreviousLayers())
+    {
+      auto itr = position.find(connection.first);
+      if (itr == position.end() || itr->second >= idx)
+      {
+        FFNN_ERROR_NAMED("network::ActivationPlan",
+                         "<" << connection.first << "> does not precede <" << layers[idx]->getID() << ">.");
+        return false;
+      }
+      // Network inputs are written before the pass begins
+      const bool is_source = layers[itr->second]->getPreviousLayers().empty();
+      range.first = std::min(range.first, is_source ? std::size_t(0) : itr->second);
+      range.last = std::max(range.last, last_read[itr->second]);
+      has_next[itr->second] = true;
+    }
+    ranges.push_back(range);
+  }
+  for (auto& range : ranges)
+  {
+    if (!has_next[range.layer])
+    {
+      range.last = std::numeric_limits<std::size_t>::max();
+    }
+  }
+
+  // Greedily pack ranges into slots, in order of first write
+  std::sort(ranges.begin(), ranges.end(),
+            [](const LiveRange& lhs, const LiveRange& rhs) { return lhs.first < rhs.first; });
+
+  std::vector<std::size_t> slot_last;
+  std::vector<std::size_t> slot_size;
+  for (auto& range : ranges)
+  {
+    const std::size_t size = layers[range.layer]->inputSize();
+
+    // Prefer the smallest free slot which fits; otherwise grow the largest free slot
+    std::size_t best = slot_last.size();
+    for (std::size_t sdx = 0; sdx < slot_last.size(); sdx++)
+    {
+      if (slot_last[sdx] >= range.first)
+      {
+        continue;
+      }
+      else if (best == slot_last.size())
+      {
+        best = sdx;
+        continue;
+      }
+
+      const bool fits = (slot_size[sdx] >= size);
+      const bool best_fits = (slot_size[best] >= size);
+      if ((fits && (!best_fits || slot_size[sdx] < slot_size[best])) ||
+          (!fits && !best_fits && slot_size[sdx] > slot_size[best]))
+      {
+        best = sdx;
+      }
+    }
+
+    if (best == slot_last.size())
+    {
+      slot_last.push_back(range.last);
+      slot_size.push_back(size);
+    }
+    else
+    {
+      slot_last[best] = range.last;
+      slot_size[best] = std::max(slot_size[best], size);
+    }
+    range.slot = best;
+    unplanned_ += size;
+  }
+
+  // Allocate slots and relocate layer inputs
+  slots_.resize(slot_size.size());
+  for (std::size_t sdx = 0; sdx < slot_size.size(); sdx++)
+  {
+    slots_[sdx].resize(slot_size[sdx], 0);
+  }
+  for (const auto& range : ranges)
+  {
+    const auto& layer = layers[range.layer];
+    planned_layers_.push_back(layer);
+    if (!layer->relocateInput(slots_[range.slot].data()))
+    {
+      FFNN_ERROR_NAMED("network::ActivationPlan", "<" << layer->getID() << "> could not be relocated.");
+      release();
+      return false;
+    }
+  }
+
+  FFNN_DEBUG_NAMED("network::ActivationPlan",
+                   "Planned " << ranges.size() << " layer inputs into " << slots_.size() <<
+                   " slots (" << planned() << " of " << unplanned_ << " values).");
+  return true;
+}
+
+template<typename ValueType>
+void ActivationPlan<ValueType>::release()
+{
+  for (const auto& layer : planned_layers_)
+  {
+    layer->relocateInput(NULL);
+  }
+  planned_layers_.clear();
+  slots_.clear();
+  unplanned_ = 0;
+}
+
+template<typename ValueType>
+std::size_t ActivationPlan<ValueType>::planned() const
+{
+  std::size_t total = 0;
+  for (const auto& slot : slots_)
+  {
+    total += slot.size();
+  }
+  return total;
+}
+}  // namespace network
+}  // namespace ffnn
@@ -0,0 +1,177 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+BatchQueue<ValueType>::Parameters::Parameters(SizeType max_batch_size, std::chrono::microseconds timeout) :
+  max_batch_size(max_batch_size),
+  timeout(timeout)
+{
+  FFNN_ASSERT_MSG(max_batch_size > 0, "[max_batch_size] should be positive");
+}
+
+template<typename ValueType>
+BatchQueue<ValueType>::Metrics::Metrics() :
+  requests(0),
+  total_queueing_delay(0),
+  max_queueing_delay(0)
+{}
+
+template<typename ValueType>
+std::size_t BatchQueue<ValueType>::Metrics::batches() const
+{
+  std::size_t count = 0;
+  for (const auto& n : batch_size_histogram)
+  {
+    count += n;
+  }
+  return count;
+}
+
+template<typename ValueType>
+std::chrono::microseconds BatchQueue<ValueType>::Metrics::meanQueueingDelay() const
+{
+  return requests ? (total_queueing_delay / static_cast<std::chrono::microseconds::rep>(requests)) : std::chrono::microseconds(0);
+}
+
+template<typename ValueType>
+BatchQueue<ValueType>::BatchQueue(const PlanType& plan, const Parameters& config) :
+  plan_(plan),
+  config_(config),
+  stopping_(false)
+{
+  FFNN_ASSERT_MSG(plan.isCompiled(), "Plan is not compiled.");
+  FFNN_ASSERT_MSG(plan.inputCount() == 1 && plan.outputCount() == 1,
+                  "Network must have one input and one output.");
+  metrics_.batch_size_histogram.resize(config_.max_batch_size + 1, 0);
+  thread_ = std::thread(&BatchQueue::run, this);
+}
+
+template<typename ValueType>
+BatchQueue<ValueType>::~BatchQueue()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+template<typename ValueType>
+std::future<typename BatchQueue<ValueType>::SampleVector>
+BatchQueue<ValueType>::submit(const SampleVector& input)
+{
+  FFNN_ASSERT_MSG(input.size() == plan_.inputSize(0), "Input sample size mismatch.");
+
+  Request request;
+  request.input = input;
+  request.queued = Clock::now();
+  std::future<SampleVector> output = request.output.get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.push_back(std::move(request));
+  }
+  cv_.notify_one();
+  return output;
+}
+
+template<typename ValueType>
+typename BatchQueue<ValueType>::Metrics BatchQueue<ValueType>::getMetrics() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+template<typename ValueType>
+void BatchQueue<ValueType>::resetMetrics()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  metrics_ = Metrics();
+  metrics_.batch_size_histogram.resize(config_.max_batch_size + 1, 0);
+}
+
+template<typename ValueType>
+void BatchQueue<ValueType>::run()
+{
+  typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> BatchMatrix;
+
+  typename PlanType::Workspace workspace = plan_.createWorkspace(config_.max_batch_size);
+  BatchMatrix input(plan_.inputSize(0), config_.max_batch_size);
+  BatchMatrix output(plan_.outputSize(0), config_.max_batch_size);
+  std::vector<Request> batch;
+  batch.reserve(config_.max_batch_size);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    // Wait for a full batch, the oldest request's deadline, or shutdown
+    cv_.wait(lock, [this]() { return stopping_ || !requests_.empty(); });
+    if (requests_.empty())
+    {
+      break;
+    }
+    const Clock::time_point deadline = requests_.front().queued + config_.timeout;
+    cv_.wait_until(lock, deadline, [this]()
+    {
+      return stopping_ || static_cast<SizeType>(requests_.size()) >= config_.max_batch_size;
+    });
+
+    // Take oldest requests
+    const SizeType count = std::min(static_cast<SizeType>(requests_.size()), config_.max_batch_size);
+    const Clock::time_point start = Clock::now();
+    for (SizeType idx = 0; idx < count; idx++)
+    {
+      const auto delay = std::chrono::duration_cast<std::chrono::microseconds>(start - requests_.front().queued);
+      metrics_.total_queueing_delay += delay;
+      metrics_.max_queueing_delay = std::max(metrics_.max_queueing_delay, delay);
+      batch.push_back(std::move(requests_.front()));
+      requests_.pop_front();
+    }
+    metrics_.batch_size_histogram[count]++;
+    metrics_.requests += count;
+    lock.unlock();
+
+    // Run batched pass
+    for (SizeType idx = 0; idx < count; idx++)
+    {
+      input.col(idx) = batch[idx].input;
+    }
+    const ValueType* inputs[1] = {input.data()};
+    ValueType* outputs[1] = {output.data()};
+    if (plan_.forward(inputs, outputs, count, workspace))
+    {
+      for (SizeType idx = 0; idx < count; idx++)
+      {
+        batch[idx].output.set_value(output.col(idx));
+      }
+    }
+    else
+    {
+      for (SizeType idx = 0; idx < count; idx++)
+      {
+        batch[idx].output.set_exception(
+          std::make_exception_ptr(std::runtime_error("Batched forward pass failed.")));
+      }
+    }
+    batch.clear();
+
+    lock.lock();
+  }
+}
+}  // namespace network
+}  // namespace ffnn
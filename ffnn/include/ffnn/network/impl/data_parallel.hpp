@@ -0,0 +1,196 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+DataParallel<ValueType>::DataParallel() :
+  task_(NULL),
+  generation_(0),
+  pending_(0),
+  succeeded_(true),
+  stopping_(false)
+{}
+
+template<typename ValueType>
+DataParallel<ValueType>::~DataParallel()
+{
+  stop();
+}
+
+template<typename ValueType>
+bool DataParallel<ValueType>::setup(const std::vector<LayerSequence>& replicas)
+{
+  stop();
+  replicas_.clear();
+
+  if (!shareParameters(replicas))
+  {
+    return false;
+  }
+  replicas_ = replicas;
+
+  // Start worker threads
+  stopping_ = false;
+  for (std::size_t rdx = 1; rdx < replicas_.size(); rdx++)
+  {
+    threads_.emplace_back(&DataParallel::run, this, rdx, generation_);
+  }
+
+  FFNN_DEBUG_NAMED("network::DataParallel", "Set up " << replicas_.size() << " replicas.");
+  return true;
+}
+
+template<typename ValueType>
+bool DataParallel<ValueType>::step(SizeType count,
+                                   const SampleLoader& load_inputs,
+                                   const SampleLoader& load_targets)
+{
+  FFNN_ASSERT_MSG(!replicas_.empty(), "Trainer is not set up.");
+  const std::size_t replica_count = replicas_.size();
+
+  // Forward/backward passes over a contiguous sample range per replica
+  const Task passes = [this, count, replica_count, &load_inputs, &load_targets](std::size_t rdx)
+  {
+    const LayerSequence& layers = replicas_[rdx];
+    const SizeType first = static_cast<SizeType>((count * rdx) / replica_count);
+    const SizeType last = static_cast<SizeType>((count * (rdx + 1)) / replica_count);
+    for (SizeType sdx = first; sdx < last; sdx++)
+    {
+      if (!load_inputs(layers, sdx))
+      {
+        return false;
+      }
+      for (const auto& layer : layers)
+      {
+        if (!layer->forward())
+        {
+          return false;
+        }
+      }
+      if (!load_targets(layers, sdx))
+      {
+        return false;
+      }
+      for (auto itr = layers.rbegin(); itr != layers.rend(); ++itr)
+      {
+        if (!(*itr)->backward())
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+  if (!dispatch(passes))
+  {
+    return false;
+  }
+
+  // Pairwise tree reduction of gradients into the first replica
+  for (std::size_t stride = 1; stride < replica_count; stride *= 2)
+  {
+    const Task reduce = [this, stride, replica_count](std::size_t rdx)
+    {
+      if (rdx % (2 * stride) != 0 || rdx + stride >= replica_count)
+      {
+        return true;
+      }
+      const LayerSequence& into = replicas_[rdx];
+      const LayerSequence& from = replicas_[rdx + stride];
+      for (std::size_t ldx = 0; ldx < into.size(); ldx++)
+      {
+        if (!into[ldx]->mergeGradients(*from[ldx]))
+        {
+          return false;
+        }
+      }
+      return true;
+    };
+    if (!dispatch(reduce))
+    {
+      return false;
+    }
+  }
+
+  // Apply summed gradients to shared parameters
+  for (const auto& layer : replicas_.front())
+  {
+    if (!layer->update())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename ValueType>
+bool DataParallel<ValueType>::dispatch(const Task& task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    pending_ = threads_.size();
+    succeeded_ = true;
+    ++generation_;
+  }
+  start_cv_.notify_all();
+
+  const bool succeeded = task(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return pending_ == 0; });
+  task_ = NULL;
+  return succeeded && succeeded_;
+}
+
+template<typename ValueType>
+void DataParallel<ValueType>::run(std::size_t replica, std::size_t generation)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    start_cv_.wait(lock, [this, generation]() { return stopping_ || generation_ != generation; });
+    if (stopping_)
+    {
+      break;
+    }
+    generation = generation_;
+    const Task* task = task_;
+    lock.unlock();
+
+    const bool succeeded = (*task)(replica);
+
+    lock.lock();
+    succeeded_ = succeeded_ && succeeded;
+    if (--pending_ == 0)
+    {
+      done_cv_.notify_one();
+    }
+  }
+}
+
+template<typename ValueType>
+void DataParallel<ValueType>::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  start_cv_.notify_all();
+  for (auto& thread : threads_)
+  {
+    thread.join();
+  }
+  threads_.clear();
+}
+}  // namespace network
+}  // namespace ffnn
@@ -0,0 +1,132 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <typeinfo>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+
+// FFNN
+#include <ffnn/logging.h>
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/neuron/linear.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+std::size_t fold(Graph<ValueType>& graph)
+{
+  typedef layer::Layer<ValueType> LayerType;
+  typedef layer::Activation<ValueType, neuron::Linear> Identity;
+  typedef layer::FullyConnected<ValueType> Affine;
+
+  auto& nodes = graph.nodes;
+  auto next = graph.next();
+  std::vector<bool> removed(nodes.size(), false);
+
+  // Replaces a previous node of a subsequent node
+  const auto replace = [&nodes, &next](std::size_t idx, std::size_t from, std::size_t to)
+  {
+    std::replace(nodes[idx].prev.begin(), nodes[idx].prev.end(), from, to);
+    next[to].push_back(idx);
+  };
+
+  // Drop identity activations
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    const LayerType& layer = *nodes[idx].layer;
+    if (typeid(layer) != typeid(Identity) || nodes[idx].prev.size() != 1UL || next[idx].empty())
+    {
+      continue;
+    }
+
+    // Subsequent nodes must not already read the previous node (as a separate segment)
+    const std::size_t pdx = nodes[idx].prev.front();
+    bool foldable = true;
+    for (const auto ndx : next[idx])
+    {
+      const auto& prev = nodes[ndx].prev;
+      foldable = foldable && (std::find(prev.begin(), prev.end(), pdx) == prev.end());
+    }
+    if (!foldable)
+    {
+      continue;
+    }
+
+    for (const auto ndx : next[idx])
+    {
+      replace(ndx, idx, pdx);
+    }
+    next[pdx].erase(std::find(next[pdx].begin(), next[pdx].end(), idx));
+    next[idx].clear();
+    removed[idx] = true;
+  }
+
+  // Multiply consecutive affine layers
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    const LayerType& layer = *nodes[idx].layer;
+    if (removed[idx] || typeid(layer) != typeid(Affine) || nodes[idx].prev.size() != 1UL)
+    {
+      continue;
+    }
+
+    const std::size_t pdx = nodes[idx].prev.front();
+    const LayerType& prev_layer = *nodes[pdx].layer;
+    if (typeid(prev_layer) != typeid(Affine) || next[pdx].size() != 1UL)
+    {
+      continue;
+    }
+
+    // Fold only if the folded layer takes fewer multiply-adds
+    const Affine& first = static_cast<const Affine&>(prev_layer);
+    const Affine& second = static_cast<const Affine&>(layer);
+    const std::size_t inputs = first.inputSize();
+    const std::size_t hidden = first.outputSize();
+    const std::size_t outputs = second.outputSize();
+    if (outputs * inputs >= hidden * (inputs + outputs))
+    {
+      continue;
+    }
+
+    // Create a stand-alone layer over a placeholder input of the same size
+    auto input = boost::make_shared<layer::Input<ValueType>>(static_cast<typename LayerType::SizeType>(inputs));
+    auto folded = boost::make_shared<Affine>(static_cast<typename LayerType::SizeType>(outputs));
+    if (!layer::connect<LayerType>(input, folded) ||
+        !input->initialize() ||
+        !folded->initialize() ||
+        !folded->setParameters(second.getWeights() * first.getWeights(),
+                               second.getWeights() * first.getBiases() + second.getBiases()))
+    {
+      FFNN_ERROR_NAMED("network::fold", "Could not create folded layer.");
+      continue;
+    }
+
+    FFNN_DEBUG_NAMED("network::fold",
+                     "Folded <" << first.getID() << "> and <" << second.getID() << "> (" <<
+                     hidden * (inputs + outputs) << " -> " << outputs * inputs << " multiply-adds).");
+
+    nodes[idx].layer = folded;
+    nodes[idx].prev = nodes[pdx].prev;
+    for (const auto qdx : nodes[pdx].prev)
+    {
+      std::replace(next[qdx].begin(), next[qdx].end(), pdx, idx);
+    }
+    next[pdx].clear();
+    removed[pdx] = true;
+  }
+
+  graph.remove(removed);
+  return std::count(removed.begin(), removed.end(), true);
+}
+}  // namespace network
+}  // namespace ffnn
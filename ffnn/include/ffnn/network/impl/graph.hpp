@@ -0,0 +1,102 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <map>
+#include <string>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+bool Graph<ValueType>::build(const LayerSequence& layers)
+{
+  nodes.clear();
+
+  // Resolve forward-pass position of each layer
+  std::map<std::string, std::size_t> position;
+  for (std::size_t idx = 0; idx < layers.size(); idx++)
+  {
+    FFNN_ASSERT_MSG(layers[idx]->isInitialized(), "Layer is not initialized.");
+    position[layers[idx]->getID()] = idx;
+  }
+
+  nodes.resize(layers.size());
+  for (std::size_t idx = 0; idx < layers.size(); idx++)
+  {
+    nodes[idx].layer = layers[idx];
+    for (const auto& connection : layers[idx]->getPreviousLayers())
+    {
+      auto itr = position.find(connection.first);
+      if (itr == position.end() || itr->second >= idx)
+      {
+        FFNN_ERROR_NAMED("network::Graph",
+                         "<" << connection.first << "> does not precede <" << layers[idx]->getID() << ">.");
+        nodes.clear();
+        return false;
+      }
+      nodes[idx].prev.push_back(itr->second);
+    }
+  }
+  return true;
+}
+
+template<typename ValueType>
+std::vector<std::vector<std::size_t>> Graph<ValueType>::next() const
+{
+  std::vector<std::vector<std::size_t>> next(nodes.size());
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    for (const auto pdx : nodes[idx].prev)
+    {
+      next[pdx].push_back(idx);
+    }
+  }
+  return next;
+}
+
+template<typename ValueType>
+void Graph<ValueType>::remove(const std::vector<bool>& removed)
+{
+  FFNN_ASSERT_MSG(removed.size() == nodes.size(), "Expected one flag per node.");
+
+  std::vector<std::size_t> index(nodes.size());
+  std::vector<Node> remaining;
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    if (!removed[idx])
+    {
+      index[idx] = remaining.size();
+      remaining.push_back(nodes[idx]);
+    }
+  }
+  for (auto& node : remaining)
+  {
+    for (auto& pdx : node.prev)
+    {
+      FFNN_ASSERT_MSG(!removed[pdx], "Removed node precedes a remaining node.");
+      pdx = index[pdx];
+    }
+  }
+  nodes.swap(remaining);
+}
+
+template<typename ValueType>
+typename Graph<ValueType>::LayerSequence Graph<ValueType>::layers() const
+{
+  LayerSequence layers;
+  for (const auto& node : nodes)
+  {
+    layers.push_back(node.layer);
+  }
+  return layers;
+}
+}  // namespace network
+}  // namespace ffnn
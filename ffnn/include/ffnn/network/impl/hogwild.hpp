@@ -0,0 +1,109 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+Hogwild<ValueType>::Parameters::Parameters(SizeType batch_size) :
+  batch_size(batch_size)
+{
+  FFNN_ASSERT_MSG(batch_size > 0, "[batch_size] should be positive");
+}
+
+template<typename ValueType>
+Hogwild<ValueType>::Hogwild(const Parameters& config) :
+  config_(config)
+{}
+
+template<typename ValueType>
+bool Hogwild<ValueType>::setup(const std::vector<LayerSequence>& replicas)
+{
+  replicas_.clear();
+  if (!shareParameters(replicas))
+  {
+    return false;
+  }
+  replicas_ = replicas;
+
+  FFNN_DEBUG_NAMED("network::Hogwild", "Set up " << replicas_.size() << " replicas.");
+  return true;
+}
+
+template<typename ValueType>
+bool Hogwild<ValueType>::run(SizeType count,
+                             const SampleLoader& load_inputs,
+                             const SampleLoader& load_targets)
+{
+  FFNN_ASSERT_MSG(!replicas_.empty(), "Trainer is not set up.");
+
+  std::atomic<SizeType> next(0);
+  std::atomic<bool> succeeded(true);
+
+  // Claims and trains on mini-batches until samples are exhausted or a step fails
+  const auto train = [this, count, &next, &succeeded, &load_inputs, &load_targets](std::size_t rdx)
+  {
+    const LayerSequence& layers = replicas_[rdx];
+    while (succeeded.load(std::memory_order_relaxed))
+    {
+      const SizeType first = next.fetch_add(config_.batch_size, std::memory_order_relaxed);
+      if (first >= count)
+      {
+        return;
+      }
+
+      bool ok = true;
+      const SizeType last = std::min(first + config_.batch_size, count);
+      for (SizeType sdx = first; ok && sdx < last; sdx++)
+      {
+        ok = load_inputs(layers, sdx);
+        for (auto itr = layers.begin(); ok && itr != layers.end(); ++itr)
+        {
+          ok = (*itr)->forward();
+        }
+        ok = ok && load_targets(layers, sdx);
+        for (auto itr = layers.rbegin(); ok && itr != layers.rend(); ++itr)
+        {
+          ok = (*itr)->backward();
+        }
+      }
+
+      // Apply updates to shared parameters without synchronization
+      for (auto itr = layers.begin(); ok && itr != layers.end(); ++itr)
+      {
+        ok = (*itr)->update();
+      }
+
+      if (!ok)
+      {
+        succeeded.store(false, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t rdx = 1; rdx < replicas_.size(); rdx++)
+  {
+    threads.emplace_back(train, rdx);
+  }
+  train(0);
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  return succeeded.load();
+}
+}  // namespace network
+}  // namespace ffnn
@@ -0,0 +1,558 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+#include <ffnn/network/fold.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+InferencePlan<ValueType>::Parameters::Parameters(bool fold, ValueType fold_tolerance) :
+  fold(fold),
+  fold_tolerance(fold_tolerance)
+{
+  FFNN_ASSERT_MSG(fold_tolerance >= 0, "[fold_tolerance] should be non-negative");
+}
+
+template<typename ValueType>
+InferencePlan<ValueType>::InferencePlan(const Parameters& config) :
+  config_(config)
+{}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::compile(const LayerSequence& layers)
+{
+  GraphType graph;
+  if (!graph.build(layers))
+  {
+    layers_.clear();
+    return false;
+  }
+
+  GraphType folded = graph;
+  if (!config_.fold || fold(folded) == 0UL)
+  {
+    return compile(graph);
+  }
+
+  // Check folded plan against unfolded plan
+  static const SizeType SampleCount = 8;
+  InferencePlan reference;
+  if (!reference.compile(graph))
+  {
+    layers_.clear();
+    return false;
+  }
+  if (compile(folded) && matches(reference, SampleCount))
+  {
+    FFNN_DEBUG_NAMED("network::InferencePlan",
+                     "Folded " << graph.nodes.size() - folded.nodes.size() << " layers.");
+    return true;
+  }
+
+  FFNN_WARN_NAMED("network::InferencePlan", "Folded plan does not match layer graph. Using unfolded plan.");
+  return compile(graph);
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::compile(const GraphType& graph)
+{
+  layers_.clear();
+  steps_.clear();
+  roots_.clear();
+  region_rows_.clear();
+  inputs_.clear();
+  outputs_.clear();
+
+  const auto& nodes = graph.nodes;
+  const auto next = graph.next();
+
+  // Create concatenated input regions for multi-input layers, and resolve each
+  // previous layer's segment offset (same layout as layer::Layer::connectInputLayers)
+  std::vector<View> input_view(nodes.size());
+  std::map<std::pair<std::size_t, std::size_t>, SizeType> segment_offset;
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    const auto& prev = nodes[idx].prev;
+    if (prev.size() < 2UL)
+    {
+      continue;
+    }
+
+    SizeType offset = 0;
+    for (const auto pdx : prev)
+    {
+      offset = aligned::padOffset<ValueType>(offset);
+      segment_offset[std::make_pair(pdx, idx)] = offset;
+      offset += nodes[pdx].layer->outputSize();
+    }
+    if (offset != nodes[idx].layer->inputSize())
+    {
+      FFNN_ERROR_NAMED("network::InferencePlan", "<" << nodes[idx].layer->getID() << "> has unexpected input size.");
+      return false;
+    }
+
+    input_view[idx].region = static_cast<SizeType>(region_rows_.size());
+    input_view[idx].offset = 0;
+    input_view[idx].rows = nodes[idx].layer->inputSize();
+    region_rows_.push_back(aligned::padOffset<ValueType>(nodes[idx].layer->inputSize()));
+  }
+
+  // Resolve where each layer writes its outputs
+  std::vector<View> output_view(nodes.size());
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    output_view[idx].rows = nodes[idx].layer->outputSize();
+    if (next[idx].size() == 1UL && nodes[next[idx].front()].prev.size() > 1UL)
+    {
+      // Write directly into concatenated input of the only subsequent layer
+      output_view[idx].region = input_view[next[idx].front()].region;
+      output_view[idx].offset = segment_offset[std::make_pair(idx, next[idx].front())];
+    }
+    else if (!next[idx].empty())
+    {
+      output_view[idx].region = static_cast<SizeType>(region_rows_.size());
+      output_view[idx].offset = 0;
+      region_rows_.push_back(aligned::padOffset<ValueType>(nodes[idx].layer->outputSize()));
+    }
+  }
+
+  // Create layer evaluation steps
+  static constexpr std::size_t NoStep = static_cast<std::size_t>(-1);
+  std::vector<std::size_t> step_index(nodes.size(), NoStep);
+  for (std::size_t idx = 0; idx < nodes.size(); idx++)
+  {
+    const auto& prev = nodes[idx].prev;
+
+    // Network inputs are copied into their output locations
+    if (prev.empty())
+    {
+      if (!next[idx].empty())
+      {
+        inputs_.push_back(output_view[idx]);
+      }
+      continue;
+    }
+
+    Step step;
+    step.layer = next[idx].empty() ? NULL : nodes[idx].layer.get();
+    step.output = output_view[idx];
+    step.dependencies = 0;
+    if (prev.size() == 1UL)
+    {
+      step.input = output_view[prev.front()];
+    }
+    else
+    {
+      step.input = input_view[idx];
+      for (const auto pdx : prev)
+      {
+        // Producers which also feed other layers are copied into the concatenated input
+        if (output_view[pdx].region != input_view[idx].region)
+        {
+          Gather gather;
+          gather.from = output_view[pdx];
+          gather.to = input_view[idx];
+          gather.to.offset = segment_offset[std::make_pair(pdx, idx)];
+          gather.to.rows = output_view[pdx].rows;
+          step.gathers.push_back(gather);
+        }
+      }
+    }
+
+    // Layers with no subsequent layers are network outputs
+    if (next[idx].empty())
+    {
+      outputs_.push_back(step.input);
+      if (step.gathers.empty())
+      {
+        continue;
+      }
+    }
+
+    // Resolve steps which produce the inputs of this step
+    step_index[idx] = steps_.size();
+    for (const auto pdx : prev)
+    {
+      const std::size_t sdx = step_index[pdx];
+      if (sdx != NoStep)
+      {
+        steps_[sdx].successors.push_back(static_cast<SizeType>(step_index[idx]));
+        step.dependencies++;
+      }
+    }
+    if (step.dependencies == 0)
+    {
+      roots_.push_back(static_cast<SizeType>(step_index[idx]));
+    }
+    steps_.push_back(step);
+  }
+  layers_ = graph.layers();
+
+  // Check that all layers support stateless forward propagation
+  Workspace workspace = createWorkspace(1);
+  std::vector<aligned::Buffer<ValueType>> inputs(inputs_.size());
+  std::vector<aligned::Buffer<ValueType>> outputs(outputs_.size());
+  std::vector<const ValueType*> input_ptrs;
+  std::vector<ValueType*> output_ptrs;
+  for (std::size_t k = 0; k < inputs_.size(); k++)
+  {
+    inputs[k].resize(inputs_[k].rows, 0);
+    input_ptrs.push_back(inputs[k].data());
+  }
+  for (std::size_t k = 0; k < outputs_.size(); k++)
+  {
+    outputs[k].resize(outputs_[k].rows, 0);
+    output_ptrs.push_back(outputs[k].data());
+  }
+  if (!forward(input_ptrs.data(), output_ptrs.data(), 1, workspace))
+  {
+    FFNN_ERROR_NAMED("network::InferencePlan", "Network contains layers without stateless forward propagation.");
+    layers_.clear();
+    return false;
+  }
+
+  FFNN_DEBUG_NAMED("network::InferencePlan",
+                   "Compiled " << steps_.size() << " steps over " << region_rows_.size() << " regions (" <<
+                   inputs_.size() << " inputs, " << outputs_.size() << " outputs).");
+  return true;
+}
+
+template<typename ValueType>
+typename InferencePlan<ValueType>::Workspace InferencePlan<ValueType>::createWorkspace(SizeType capacity) const
+{
+  Workspace workspace;
+  workspace.capacity_ = capacity;
+  workspace.pending_ = std::vector<std::atomic<SizeType>>(steps_.size());
+  workspace.regions_.resize(region_rows_.size());
+  for (std::size_t rdx = 0; rdx < region_rows_.size(); rdx++)
+  {
+    // NOTE: Padding rows of concatenated inputs must remain zero
+    workspace.regions_[rdx].resize(region_rows_[rdx] * capacity, 0);
+  }
+  return workspace;
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::forward(const ValueType* const* inputs,
+                                       ValueType* const* outputs,
+                                       SizeType count,
+                                       Workspace& workspace) const
+{
+  FFNN_ASSERT_MSG(isCompiled(), "Plan is not compiled.");
+  if (count > workspace.capacity_ || workspace.regions_.size() != region_rows_.size())
+  {
+    FFNN_ERROR_NAMED("network::InferencePlan", "Workspace was not created for " << count << " samples.");
+    return false;
+  }
+
+  load(inputs, count, workspace);
+  if (!evaluate(count, workspace, NULL))
+  {
+    return false;
+  }
+  store(outputs, count, workspace);
+  return true;
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::sample(const ValueType* const* inputs,
+                                      ValueType* const* outputs,
+                                      SizeType count,
+                                      Workspace& workspace,
+                                      std::uint32_t pass) const
+{
+  FFNN_ASSERT_MSG(isCompiled(), "Plan is not compiled.");
+  if (count > workspace.capacity_ || workspace.regions_.size() != region_rows_.size())
+  {
+    FFNN_ERROR_NAMED("network::InferencePlan", "Workspace was not created for " << count << " samples.");
+    return false;
+  }
+
+  load(inputs, count, workspace);
+  if (!evaluate(count, workspace, &pass))
+  {
+    return false;
+  }
+  store(outputs, count, workspace);
+  return true;
+}
+
+template<typename ValueType>
+template<typename InputVectorType, typename OutputVectorType>
+bool InferencePlan<ValueType>::sample(const InputVectorType& input,
+                                      SizeType samples,
+                                      OutputVectorType& mean,
+                                      OutputVectorType& variance,
+                                      Workspace& workspace,
+                                      std::uint32_t pass) const
+{
+  typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic> MatrixType;
+  typedef Eigen::Map<MatrixType, Eigen::Unaligned, Eigen::OuterStride<>> BlockType;
+
+  FFNN_ASSERT_MSG(isCompiled(), "Plan is not compiled.");
+  FFNN_ASSERT_MSG(inputCount() == 1 && outputCount() == 1, "Network must have one input and one output.");
+  FFNN_ASSERT_MSG(input.size() == inputSize(0), "Input sample size mismatch.");
+  FFNN_ASSERT_MSG(mean.size() == outputSize(0) && variance.size() == outputSize(0), "Output size mismatch.");
+  if (samples == 0 || samples > workspace.capacity_ || workspace.regions_.size() != region_rows_.size())
+  {
+    FFNN_ERROR_NAMED("network::InferencePlan", "Workspace was not created for " << samples << " samples.");
+    return false;
+  }
+
+  // Replicate input in place
+  const View& in = inputs_.front();
+  BlockType(data(in, workspace), in.rows, samples, Eigen::OuterStride<>(stride(in))).colwise() = input;
+
+  if (!evaluate(samples, workspace, &pass))
+  {
+    return false;
+  }
+
+  // Reduce outputs in place
+  const View& out = outputs_.front();
+  const BlockType y(data(out, workspace), out.rows, samples, Eigen::OuterStride<>(stride(out)));
+  mean = y.rowwise().mean();
+  variance = (y.colwise() - mean).array().square().rowwise().mean();
+  return true;
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::forward(const ValueType* const* inputs,
+                                       ValueType* const* outputs,
+                                       SizeType count,
+                                       Workspace& workspace,
+                                       thread::WorkStealingPool& pool) const
+{
+  FFNN_ASSERT_MSG(isCompiled(), "Plan is not compiled.");
+  if (count > workspace.capacity_ ||
+      workspace.regions_.size() != region_rows_.size() ||
+      workspace.pending_.size() != steps_.size())
+  {
+    FFNN_ERROR_NAMED("network::InferencePlan", "Workspace was not created for " << count << " samples.");
+    return false;
+  }
+
+  load(inputs, count, workspace);
+
+  // Reset dependency counters
+  for (std::size_t sdx = 0; sdx < steps_.size(); sdx++)
+  {
+    workspace.pending_[sdx].store(steps_[sdx].dependencies, std::memory_order_relaxed);
+  }
+
+  Pass pass;
+  pass.plan = this;
+  pass.workspace = &workspace;
+  pass.pool = &pool;
+  pass.count = count;
+  pass.remaining = static_cast<SizeType>(steps_.size());
+  pass.failed = false;
+
+  // Start independent branches, then help evaluate until every step has completed
+  for (const auto sdx : roots_)
+  {
+    const thread::WorkStealingPool::Task task{&InferencePlan::evaluate, &pass, static_cast<std::size_t>(sdx)};
+    pool.submit(task);
+  }
+  pool.runUntil([&pass]() { return pass.remaining.load(std::memory_order_acquire) == 0; });
+
+  if (pass.failed)
+  {
+    return false;
+  }
+  store(outputs, count, workspace);
+  return true;
+}
+
+template<typename ValueType>
+void InferencePlan<ValueType>::load(const ValueType* const* inputs, SizeType count, Workspace& workspace) const
+{
+  for (std::size_t k = 0; k < inputs_.size(); k++)
+  {
+    const View& view = inputs_[k];
+    copy(inputs[k], view.rows, data(view, workspace), stride(view), view.rows, count);
+  }
+}
+
+template<typename ValueType>
+void InferencePlan<ValueType>::store(ValueType* const* outputs, SizeType count, Workspace& workspace) const
+{
+  for (std::size_t k = 0; k < outputs_.size(); k++)
+  {
+    const View& view = outputs_[k];
+    copy(data(view, workspace), stride(view), outputs[k], view.rows, view.rows, count);
+  }
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::evaluate(const Step& step,
+                                        SizeType count,
+                                        Workspace& workspace,
+                                        const std::uint32_t* pass) const
+{
+  for (const auto& gather : step.gathers)
+  {
+    copy(data(gather.from, workspace), stride(gather.from),
+         data(gather.to, workspace), stride(gather.to),
+         gather.from.rows, count);
+  }
+
+  if (!step.layer)
+  {
+    return true;
+  }
+  else if (pass)
+  {
+    return step.layer->sample(data(step.input, workspace),
+                              stride(step.input),
+                              data(step.output, workspace),
+                              stride(step.output),
+                              count,
+                              *pass);
+  }
+  return step.layer->infer(data(step.input, workspace),
+                           stride(step.input),
+                           data(step.output, workspace),
+                           stride(step.output),
+                           count);
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::evaluate(SizeType count, Workspace& workspace, const std::uint32_t* pass) const
+{
+  for (const auto& step : steps_)
+  {
+    if (!evaluate(step, count, workspace, pass))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename ValueType>
+void InferencePlan<ValueType>::evaluate(void* context, std::size_t sdx)
+{
+  Pass& pass = *static_cast<Pass*>(context);
+  const InferencePlan& plan = *pass.plan;
+  Workspace& workspace = *pass.workspace;
+
+  while (true)
+  {
+    const Step& step = plan.steps_[sdx];
+    if (!pass.failed.load(std::memory_order_relaxed) && !plan.evaluate(step, pass.count, workspace))
+    {
+      pass.failed = true;
+    }
+
+    // Release subsequent steps; the first one which becomes ready is evaluated on this thread
+    bool has_next = false;
+    for (const auto successor : step.successors)
+    {
+      if (workspace.pending_[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        if (!has_next)
+        {
+          sdx = successor;
+          has_next = true;
+        }
+        else
+        {
+          const thread::WorkStealingPool::Task task{&InferencePlan::evaluate, context,
+                                                    static_cast<std::size_t>(successor)};
+          pass.pool->submit(task);
+        }
+      }
+    }
+
+    // NOTE: The pass may end (and its state go out of scope) once the last step is counted
+    pass.remaining.fetch_sub(1, std::memory_order_acq_rel);
+    if (!has_next)
+    {
+      return;
+    }
+  }
+}
+
+template<typename ValueType>
+bool InferencePlan<ValueType>::matches(const InferencePlan& other, SizeType count) const
+{
+  typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic> MatrixType;
+  if (inputCount() != other.inputCount() || outputCount() != other.outputCount())
+  {
+    return false;
+  }
+
+  std::vector<MatrixType> inputs(inputCount());
+  std::vector<const ValueType*> input_ptrs;
+  for (std::size_t k = 0; k < inputCount(); k++)
+  {
+    if (inputSize(k) != other.inputSize(k))
+    {
+      return false;
+    }
+    inputs[k].setRandom(inputSize(k), count);
+    input_ptrs.push_back(inputs[k].data());
+  }
+
+  std::vector<MatrixType> outputs(outputCount()), expected(outputCount());
+  std::vector<ValueType*> output_ptrs, expected_ptrs;
+  for (std::size_t k = 0; k < outputCount(); k++)
+  {
+    if (outputSize(k) != other.outputSize(k))
+    {
+      return false;
+    }
+    outputs[k].setZero(outputSize(k), count);
+    expected[k].setZero(outputSize(k), count);
+    output_ptrs.push_back(outputs[k].data());
+    expected_ptrs.push_back(expected[k].data());
+  }
+
+  Workspace workspace = createWorkspace(count);
+  Workspace other_workspace = other.createWorkspace(count);
+  if (!forward(input_ptrs.data(), output_ptrs.data(), count, workspace) ||
+      !other.forward(input_ptrs.data(), expected_ptrs.data(), count, other_workspace))
+  {
+    return false;
+  }
+
+  for (std::size_t k = 0; k < outputCount(); k++)
+  {
+    const ValueType scale = std::max<ValueType>(1, expected[k].cwiseAbs().maxCoeff());
+    const ValueType error = (outputs[k] - expected[k]).cwiseAbs().maxCoeff();
+    if (!(error <= config_.fold_tolerance * scale))
+    {
+      FFNN_DEBUG_NAMED("network::InferencePlan",
+                       "Output " << k << " differs by " << error << " (tolerance " <<
+                       config_.fold_tolerance * scale << ").");
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename ValueType>
+void InferencePlan<ValueType>::copy(const ValueType* from, SizeType from_stride,
+                                    ValueType* to, SizeType to_stride,
+                                    SizeType rows, SizeType count)
+{
+  for (SizeType col = 0; col < count; col++)
+  {
+    std::memcpy(to + col * to_stride, from + col * from_stride, rows * sizeof(ValueType));
+  }
+}
+}  // namespace network
+}  // namespace ffnn
@@ -0,0 +1,263 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename ValueType>
+Pipeline<ValueType>::Parameters::Parameters(SizeType stages, SizeType max_batch_size, SizeType queue_depth) :
+  stages(stages),
+  max_batch_size(max_batch_size),
+  queue_depth(queue_depth)
+{
+  FFNN_ASSERT_MSG(stages > 0, "[stages] should be positive");
+  FFNN_ASSERT_MSG(max_batch_size > 0, "[max_batch_size] should be positive");
+  FFNN_ASSERT_MSG(queue_depth > 0, "[queue_depth] should be positive");
+}
+
+template<typename ValueType>
+Pipeline<ValueType>::Pipeline(const Parameters& config) :
+  config_(config),
+  stopping_(false),
+  input_size_(0),
+  output_size_(0)
+{}
+
+template<typename ValueType>
+Pipeline<ValueType>::~Pipeline()
+{
+  stop();
+}
+
+template<typename ValueType>
+bool Pipeline<ValueType>::compile(const LayerSequence& layers)
+{
+  stop();
+  layers_.clear();
+  stages_.clear();
+  queues_.clear();
+
+  // Check chain topology: one network input, one network output
+  if (layers.size() < 3UL)
+  {
+    FFNN_ERROR_NAMED("network::Pipeline", "Network has no layers to evaluate.");
+    return false;
+  }
+  for (std::size_t idx = 0; idx < layers.size(); idx++)
+  {
+    FFNN_ASSERT_MSG(layers[idx]->isInitialized(), "Layer is not initialized.");
+    const auto& prev = layers[idx]->getPreviousLayers();
+    if (idx == 0 ?
+        !prev.empty() :
+        (prev.size() != 1UL || prev.begin()->second != layers[idx - 1]))
+    {
+      FFNN_ERROR_NAMED("network::Pipeline", "<" << layers[idx]->getID() << "> does not form a chain.");
+      return false;
+    }
+  }
+  input_size_ = layers.front()->outputSize();
+  output_size_ = layers.back()->inputSize();
+
+  // Split evaluated layers (all but network input and output) into stages of similar cost
+  std::vector<double> cost(layers.size() - 1, 0);
+  for (std::size_t idx = 1; idx + 1 < layers.size(); idx++)
+  {
+    cost[idx] = cost[idx - 1] + layers[idx]->costPerSample();
+  }
+  const std::size_t evaluated = layers.size() - 2;
+  const std::size_t stage_count = std::min<std::size_t>(config_.stages, evaluated);
+  std::size_t first = 1;
+  for (std::size_t s = 0; s < stage_count; s++)
+  {
+    // End stage once its cumulative cost reaches its share, leaving a layer for each later stage
+    const double target = cost.back() * (s + 1) / stage_count;
+    std::size_t last = first + 1;
+    while (last < layers.size() - 1 - (stage_count - s - 1) && cost[last - 1] < target)
+    {
+      last++;
+    }
+    if (s + 1 == stage_count)
+    {
+      last = layers.size() - 1;
+    }
+
+    Stage stage;
+    stage.input_rows = layers[first - 1]->outputSize();
+    stage.max_rows = 0;
+    for (std::size_t idx = first; idx < last; idx++)
+    {
+      stage.layers.push_back(layers[idx].get());
+      stage.max_rows = std::max(stage.max_rows, layers[idx]->outputSize());
+    }
+    stages_.push_back(stage);
+    first = last;
+  }
+
+  // Create activation slot queues
+  for (std::size_t s = 0; s <= stages_.size(); s++)
+  {
+    const SizeType rows = (s == 0) ? input_size_ : stages_[s - 1].layers.back()->outputSize();
+    queues_.emplace_back(new Queue(config_.queue_depth));
+    for (SizeType idx = 0; idx < config_.queue_depth; idx++)
+    {
+      queues_.back()->slot(idx).data.resize(rows * config_.max_batch_size, 0);
+      queues_.back()->slot(idx).count = 0;
+      queues_.back()->slot(idx).failed = false;
+    }
+  }
+  for (std::size_t s = 0; s < stages_.size(); s++)
+  {
+    stages_[s].input = queues_[s].get();
+    stages_[s].output = queues_[s + 1].get();
+  }
+
+  // Check that all layers support stateless forward propagation
+  for (std::size_t idx = 1; idx + 1 < layers.size(); idx++)
+  {
+    aligned::Buffer<ValueType> x(layers[idx]->inputSize(), 0);
+    aligned::Buffer<ValueType> y(layers[idx]->outputSize(), 0);
+    if (!layers[idx]->infer(x.data(), x.size(), y.data(), y.size(), 1))
+    {
+      FFNN_ERROR_NAMED("network::Pipeline",
+                       "<" << layers[idx]->getID() << "> does not support stateless forward propagation.");
+      stages_.clear();
+      queues_.clear();
+      return false;
+    }
+  }
+  layers_ = layers;
+
+  // Start stage threads
+  stopping_ = false;
+  for (std::size_t s = 0; s < stages_.size(); s++)
+  {
+    threads_.emplace_back(&Pipeline::run, this, s);
+  }
+
+  FFNN_DEBUG_NAMED("network::Pipeline", "Compiled " << evaluated << " layers into " << stages_.size() << " stages.");
+  return true;
+}
+
+template<typename ValueType>
+bool Pipeline<ValueType>::tryPush(const ValueType* input, SizeType count)
+{
+  FFNN_ASSERT_MSG(!stages_.empty(), "Pipeline is not compiled.");
+  FFNN_ASSERT_MSG(count > 0 && count <= config_.max_batch_size, "Micro-batch size out of range.");
+
+  Slot* slot = queues_.front()->back();
+  if (!slot)
+  {
+    return false;
+  }
+  std::memcpy(slot->data.data(), input, input_size_ * count * sizeof(ValueType));
+  slot->count = count;
+  slot->failed = false;
+  queues_.front()->push();
+  return true;
+}
+
+template<typename ValueType>
+void Pipeline<ValueType>::push(const ValueType* input, SizeType count)
+{
+  while (!tryPush(input, count))
+  {
+    std::this_thread::yield();
+  }
+}
+
+template<typename ValueType>
+bool Pipeline<ValueType>::tryPop(ValueType* output, SizeType& count)
+{
+  FFNN_ASSERT_MSG(!stages_.empty(), "Pipeline is not compiled.");
+
+  Slot* slot = queues_.back()->front();
+  if (!slot)
+  {
+    return false;
+  }
+  count = slot->failed ? 0 : slot->count;
+  std::memcpy(output, slot->data.data(), output_size_ * count * sizeof(ValueType));
+  queues_.back()->pop();
+  return true;
+}
+
+template<typename ValueType>
+typename Pipeline<ValueType>::SizeType Pipeline<ValueType>::pop(ValueType* output)
+{
+  SizeType count = 0;
+  while (!tryPop(output, count))
+  {
+    std::this_thread::yield();
+  }
+  return count;
+}
+
+template<typename ValueType>
+void Pipeline<ValueType>::run(std::size_t s)
+{
+  const Stage& stage = stages_[s];
+
+  // Intermediate activations within the stage
+  aligned::Buffer<ValueType> scratch[2];
+  scratch[0].resize(stage.max_rows * config_.max_batch_size);
+  scratch[1].resize(stage.max_rows * config_.max_batch_size);
+
+  while (!stopping_.load(std::memory_order_relaxed))
+  {
+    // Wait for an input micro-batch and a free output slot
+    Slot* input = stage.input->front();
+    Slot* output = input ? stage.output->back() : NULL;
+    if (!output)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // Evaluate stage layers; micro-batches which failed in an earlier stage are passed on as-is
+    bool failed = input->failed;
+    const ValueType* x = input->data.data();
+    SizeType x_rows = stage.input_rows;
+    for (std::size_t idx = 0; idx < stage.layers.size() && !failed; idx++)
+    {
+      const LayerType* layer = stage.layers[idx];
+      ValueType* y = (idx + 1 == stage.layers.size()) ? output->data.data() : scratch[idx % 2].data();
+      if (!layer->infer(x, x_rows, y, layer->outputSize(), input->count))
+      {
+        FFNN_ERROR_NAMED("network::Pipeline", "<" << layer->getID() << "> failed to evaluate.");
+        failed = true;
+      }
+      x = y;
+      x_rows = layer->outputSize();
+    }
+
+    // Hand off micro-batch to the next stage
+    output->count = input->count;
+    output->failed = failed;
+    stage.output->push();
+    stage.input->pop();
+  }
+}
+
+template<typename ValueType>
+void Pipeline<ValueType>::stop()
+{
+  stopping_ = true;
+  for (auto& thread : threads_)
+  {
+    thread.join();
+  }
+  threads_.clear();
+}
+}  // namespace network
+}  // namespace ffnn
@@ -0,0 +1,60 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+
+namespace ffnn
+{
+namespace network
+{
+template<typename LayerSequence>
+bool shareParameters(const std::vector<LayerSequence>& replicas)
+{
+  if (replicas.empty())
+  {
+    FFNN_ERROR_NAMED("network::shareParameters", "No replicas given.");
+    return false;
+  }
+
+  // Check that replicas match
+  const LayerSequence& owner = replicas.front();
+  for (const auto& replica : replicas)
+  {
+    if (replica.size() != owner.size())
+    {
+      FFNN_ERROR_NAMED("network::shareParameters", "Replica layer counts do not match.");
+      return false;
+    }
+    for (std::size_t ldx = 0; ldx < owner.size(); ldx++)
+    {
+      FFNN_ASSERT_MSG(replica[ldx]->isInitialized(), "Layer is not initialized.");
+      if (replica[ldx]->inputSize() != owner[ldx]->inputSize() ||
+          replica[ldx]->outputSize() != owner[ldx]->outputSize())
+      {
+        FFNN_ERROR_NAMED("network::shareParameters",
+                         "<" << replica[ldx]->getID() << "> dimensions do not match <" <<
+                         owner[ldx]->getID() << ">.");
+        return false;
+      }
+    }
+  }
+
+  // Share parameters of the first replica
+  for (std::size_t rdx = 1; rdx < replicas.size(); rdx++)
+  {
+    for (std::size_t ldx = 0; ldx < owner.size(); ldx++)
+    {
+      if (!replicas[rdx][ldx]->shareParameters(*owner[ldx]))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace network
+}  // namespace ffnn
@@ -0,0 +1,411 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_INFERENCE_PLAN_H
+#define FFNN_NETWORK_INFERENCE_PLAN_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/config/global.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/network/graph.h>
+#include <ffnn/thread/work_stealing_pool.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Compiled, immutable inference plan over a layer graph
+ *
+ *        The plan reads layer parameters in place (see <code>layer::Layer::infer</code>) and
+ *        keeps all activations in a caller-supplied <code>Workspace</code>. Any number of threads
+ *        may run the same plan concurrently, each with its own workspace, while sharing one
+ *        copy of the weights.
+ *
+ *        Outputs of a layer which only feeds one multi-input layer are written directly into
+ *        that layer's concatenated input, as with the layer graph itself.
+ *
+ *        Independent branches of the layer graph may also be evaluated concurrently on a
+ *        <code>thread::WorkStealingPool</code>. Step dependencies are resolved at compile time;
+ *        a pass only resets one counter per step.
+ *
+ *        Optionally, layers which are redundant at inference time are folded when the plan is
+ *        compiled (see <code>network::fold</code>).
+ *
+ * @warning Layers must not be modified (i.e. trained) while the plan is in use
+ */
+template<typename ValueType>
+class InferencePlan
+{
+public:
+  /// Layer type standardization
+  typedef layer::Layer<ValueType> LayerType;
+
+  /// Layer sequence type standardization
+  typedef std::vector<typename LayerType::Ptr> LayerSequence;
+
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  /// Graph type standardization
+  typedef Graph<ValueType> GraphType;
+
+  /**
+   * @brief Plan configuration struct
+   */
+  struct Parameters
+  {
+    /// Fold layers which are redundant at inference time (see <code>network::fold</code>)
+    bool fold;
+
+    /// Largest difference between folded and unfolded outputs (relative to output magnitude, if above one)
+    ValueType fold_tolerance;
+
+    /**
+     * @brief Setup constructor
+     * @param fold  Fold layers which are redundant at inference time
+     * @param fold_tolerance  Largest difference between folded and unfolded outputs
+     */
+    explicit
+    Parameters(bool fold = false, ValueType fold_tolerance = 1e-4);
+  };
+
+  /**
+   * @brief Per-thread activation memory
+   * @note  Movable, but not copyable
+   */
+  class Workspace
+  {
+  public:
+    Workspace() :
+      capacity_(0)
+    {}
+
+    /**
+     * @brief Returns the largest number of samples which may be run in one pass
+     */
+    inline SizeType capacity() const
+    {
+      return capacity_;
+    }
+
+  private:
+    friend class InferencePlan;
+
+    /// Activation regions (one sample per column)
+    std::vector<aligned::Buffer<ValueType>> regions_;
+
+    /// Largest number of samples per pass
+    SizeType capacity_;
+
+    /// Unresolved dependencies of each step during a parallel pass
+    std::vector<std::atomic<SizeType>> pending_;
+  };
+
+  /**
+   * @brief Setup constructor
+   * @param config  plan configuration struct
+   */
+  explicit
+  InferencePlan(const Parameters& config = Parameters());
+
+  /**
+   * @brief Compiles a plan over a layer graph
+   * @param layers  initialized layers, in forward-pass order
+   * @retval true  if all layers support stateless forward propagation
+   * @retval false  otherwise
+   * @note  Network inputs and outputs are numbered by their order in <code>layers</code>
+   * @note  If folding is enabled, folded plan outputs are checked against those of the unfolded
+   *        plan on random inputs; the unfolded plan is used if they differ by more than
+   *        <code>Parameters::fold_tolerance</code>
+   */
+  bool compile(const LayerSequence& layers);
+
+  /**
+   * @brief Compiles a plan over a layer graph topology, as is (i.e. without folding)
+   * @param graph  topology of initialized layers
+   * @retval true  if all layers support stateless forward propagation
+   * @retval false  otherwise
+   */
+  bool compile(const GraphType& graph);
+
+  /**
+   * @brief Returns true if the plan has been compiled
+   */
+  inline bool isCompiled() const
+  {
+    return !layers_.empty();
+  }
+
+  /**
+   * @brief Creates activation memory for one thread
+   * @param capacity  largest number of samples which will be run in one pass
+   */
+  Workspace createWorkspace(SizeType capacity = 1) const;
+
+  /**
+   * @brief Runs a forward pass
+   * @param inputs  one contiguous, column-major <code>inputSize(k) x count</code> block per network input
+   * @param outputs  one contiguous, column-major <code>outputSize(k) x count</code> block per network output
+   * @param count  number of samples
+   * @param workspace  activation memory, used by this call only
+   * @retval true  if the pass succeeded
+   * @retval false  otherwise
+   */
+  bool forward(const ValueType* const* inputs,
+               ValueType* const* outputs,
+               SizeType count,
+               Workspace& workspace) const;
+
+  /**
+   * @brief Runs a forward pass, evaluating independent layers concurrently
+   * @param inputs  one contiguous, column-major <code>inputSize(k) x count</code> block per network input
+   * @param outputs  one contiguous, column-major <code>outputSize(k) x count</code> block per network output
+   * @param count  number of samples
+   * @param workspace  activation memory, used by this call only
+   * @param pool  threads to run layers on; the calling thread also runs layers until the pass is done
+   * @retval true  if the pass succeeded
+   * @retval false  otherwise
+   * @note  Outputs are identical to those of a sequential pass
+   */
+  bool forward(const ValueType* const* inputs,
+               ValueType* const* outputs,
+               SizeType count,
+               Workspace& workspace,
+               thread::WorkStealingPool& pool) const;
+
+  /**
+   * @brief Runs a forward pass for a network with one input and one output
+   * @param input  input samples, one per column
+   * @param[out] output  output samples, one per column; must be sized before the call
+   * @param workspace  activation memory, used by this call only
+   */
+  template<typename InputMatrixType, typename OutputMatrixType>
+  bool forward(const InputMatrixType& input, OutputMatrixType& output, Workspace& workspace) const
+  {
+    FFNN_ASSERT_MSG(inputCount() == 1 && outputCount() == 1, "Network must have one input and one output.");
+    FFNN_ASSERT_MSG(input.rows() == inputSize(0) && output.rows() == outputSize(0), "Sample size mismatch.");
+    FFNN_ASSERT_MSG(input.cols() == output.cols(), "Sample count mismatch.");
+    const ValueType* inputs[1] = {input.data()};
+    ValueType* outputs[1] = {output.data()};
+    return forward(inputs, outputs, static_cast<SizeType>(input.cols()), workspace);
+  }
+
+  /**
+   * @brief Runs a forward pass for a network with one input and one output, evaluating
+   *        independent layers concurrently
+   * @param input  input samples, one per column
+   * @param[out] output  output samples, one per column; must be sized before the call
+   * @param workspace  activation memory, used by this call only
+   * @param pool  threads to run layers on
+   */
+  template<typename InputMatrixType, typename OutputMatrixType>
+  bool forward(const InputMatrixType& input,
+               OutputMatrixType& output,
+               Workspace& workspace,
+               thread::WorkStealingPool& pool) const
+  {
+    FFNN_ASSERT_MSG(inputCount() == 1 && outputCount() == 1, "Network must have one input and one output.");
+    FFNN_ASSERT_MSG(input.rows() == inputSize(0) && output.rows() == outputSize(0), "Sample size mismatch.");
+    FFNN_ASSERT_MSG(input.cols() == output.cols(), "Sample count mismatch.");
+    const ValueType* inputs[1] = {input.data()};
+    ValueType* outputs[1] = {output.data()};
+    return forward(inputs, outputs, static_cast<SizeType>(input.cols()), workspace, pool);
+  }
+
+  /**
+   * @brief Runs a forward pass with stochastic regularization applied to each sample, as in
+   *        training (i.e. an independent dropout mask for each sample; see <code>layer::Layer::sample</code>)
+   * @param inputs  one contiguous, column-major <code>inputSize(k) x count</code> block per network input
+   * @param outputs  one contiguous, column-major <code>outputSize(k) x count</code> block per network output
+   * @param count  number of samples
+   * @param workspace  activation memory, used by this call only
+   * @param pass  pass identifier; passes with distinct identifiers draw distinct masks
+   * @retval true  if the pass succeeded
+   * @retval false  otherwise
+   */
+  bool sample(const ValueType* const* inputs,
+              ValueType* const* outputs,
+              SizeType count,
+              Workspace& workspace,
+              std::uint32_t pass) const;
+
+  /**
+   * @brief Estimates mean and variance of network outputs under dropout (Monte Carlo dropout),
+   *        for a network with one input and one output
+   *
+   *        The input is replicated <code>samples</code> times and run as one batch, so each
+   *        layer is evaluated once over all samples (e.g. one GEMM, instead of one GEMV per sample),
+   *        with an independent dropout mask for each sample.
+   *
+   * @param input  one input sample
+   * @param samples  number of dropout samples; at most <code>workspace.capacity()</code>
+   * @param[out] mean  output mean over all samples; must be sized before the call
+   * @param[out] variance  output variance over all samples (normalized by <code>samples</code>);
+   *             must be sized before the call
+   * @param workspace  activation memory, used by this call only
+   * @param pass  pass identifier; passes with distinct identifiers draw distinct masks
+   * @retval true  if the pass succeeded
+   * @retval false  otherwise
+   */
+  template<typename InputVectorType, typename OutputVectorType>
+  bool sample(const InputVectorType& input,
+              SizeType samples,
+              OutputVectorType& mean,
+              OutputVectorType& variance,
+              Workspace& workspace,
+              std::uint32_t pass) const;
+
+  /**
+   * @brief Returns number of network inputs
+   */
+  inline std::size_t inputCount() const
+  {
+    return inputs_.size();
+  }
+
+  /**
+   * @brief Returns number of network outputs
+   */
+  inline std::size_t outputCount() const
+  {
+    return outputs_.size();
+  }
+
+  /**
+   * @brief Returns size of one sample of a network input
+   */
+  inline SizeType inputSize(std::size_t k) const
+  {
+    return inputs_[k].rows;
+  }
+
+  /**
+   * @brief Returns size of one sample of a network output
+   */
+  inline SizeType outputSize(std::size_t k) const
+  {
+    return outputs_[k].rows;
+  }
+
+  /**
+   * @brief Returns planned layers, in evaluation order
+   * @note  Includes folded layers, which are not part of the original layer graph
+   */
+  inline const LayerSequence& getLayers() const
+  {
+    return layers_;
+  }
+
+private:
+  /// Rows of an activation region
+  struct View
+  {
+    SizeType region;
+    SizeType offset;
+    SizeType rows;
+  };
+
+  /// Copy of a producer output into a concatenated input
+  struct Gather
+  {
+    View from;
+    View to;
+  };
+
+  /// One layer evaluation
+  struct Step
+  {
+    const LayerType* layer;
+    View input;
+    View output;
+    std::vector<Gather> gathers;
+
+    /// Number of steps which must complete before this one
+    SizeType dependencies;
+
+    /// Steps which depend on this one
+    std::vector<SizeType> successors;
+  };
+
+  /// State of one parallel pass
+  struct Pass
+  {
+    const InferencePlan* plan;
+    Workspace* workspace;
+    thread::WorkStealingPool* pool;
+    SizeType count;
+    std::atomic<SizeType> remaining;
+    std::atomic<bool> failed;
+  };
+
+  /// Returns pointer to first element of a view
+  inline ValueType* data(const View& view, Workspace& workspace) const
+  {
+    return workspace.regions_[view.region].data() + view.offset;
+  }
+
+  /// Returns distance between columns of a view
+  inline SizeType stride(const View& view) const
+  {
+    return region_rows_[view.region];
+  }
+
+  /// Loads network inputs into a workspace
+  void load(const ValueType* const* inputs, SizeType count, Workspace& workspace) const;
+
+  /// Stores network outputs from a workspace
+  void store(ValueType* const* outputs, SizeType count, Workspace& workspace) const;
+
+  /// Evaluates one step (with stochastic regularization, if a pass identifier is given)
+  bool evaluate(const Step& step, SizeType count, Workspace& workspace, const std::uint32_t* pass = NULL) const;
+
+  /// Evaluates all steps, in order
+  bool evaluate(SizeType count, Workspace& workspace, const std::uint32_t* pass) const;
+
+  /// Evaluates a step of a parallel pass, then any steps it makes ready
+  static void evaluate(void* pass, std::size_t sdx);
+
+  /// Returns true if outputs match those of another plan (with the same inputs/outputs) on random inputs
+  bool matches(const InferencePlan& other, SizeType count) const;
+
+  /// Copies <code>count</code> columns between views/blocks
+  static void copy(const ValueType* from, SizeType from_stride,
+                   ValueType* to, SizeType to_stride,
+                   SizeType rows, SizeType count);
+
+  /// Plan configuration
+  Parameters config_;
+
+  /// Planned layers (keeps parameters alive)
+  LayerSequence layers_;
+
+  /// Layer evaluations, in order
+  std::vector<Step> steps_;
+
+  /// Steps without dependencies
+  std::vector<SizeType> roots_;
+
+  /// Rows of each activation region
+  std::vector<SizeType> region_rows_;
+
+  /// Network input locations
+  std::vector<View> inputs_;
+
+  /// Network output locations
+  std::vector<View> outputs_;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/inference_plan.hpp>
+#endif  // FFNN_NETWORK_INFERENCE_PLAN_H
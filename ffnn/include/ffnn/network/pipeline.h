@@ -0,0 +1,224 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_PIPELINE_H
+#define FFNN_NETWORK_PIPELINE_H
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/config/global.h>
+#include <ffnn/internal/spsc_queue.h>
+#include <ffnn/layer/layer.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Pipeline-parallel streaming inference over a chain network
+ *
+ *        Splits the layers of a chain network into stages of similar cost (see
+ *        <code>layer::Layer::costPerSample</code>), each run by its own thread. Micro-batches flow between stages through bounded, lock-free queues of
+ *        activation slots, so stage <code>i</code> works on micro-batch <code>t</code> while
+ *        stage <code>i+1</code> works on micro-batch <code>t-1</code>. Each link holds
+ *        <code>queue_depth</code> slots (two, double-buffered, by default) in place of a single
+ *        shared layer input buffer.
+ *
+ *        One client thread may <code>push</code> inputs while another <code>pop</code>s outputs;
+ *        outputs are returned in input order.
+ *
+ * @note  Layers are evaluated with <code>layer::Layer::infer</code>, reading parameters in place
+ * @warning Layers must not be modified (i.e. trained) while the pipeline is running
+ * @warning Stage threads busy-wait (yielding) for work
+ */
+template<typename ValueType>
+class Pipeline
+{
+public:
+  /// Layer type standardization
+  typedef layer::Layer<ValueType> LayerType;
+
+  /// Layer sequence type standardization
+  typedef std::vector<typename LayerType::Ptr> LayerSequence;
+
+  /// Size type standardization
+  typedef FFNN_SIZE_TYPE SizeType;
+
+  /// A configuration object for a Pipeline
+  struct Parameters
+  {
+    /// Largest number of stages (threads)
+    SizeType stages;
+
+    /// Largest number of samples per micro-batch
+    SizeType max_batch_size;
+
+    /// Number of activation slots between consecutive stages
+    SizeType queue_depth;
+
+    /**
+     * @brief Setup constructor
+     * @param stages  Largest number of stages (threads)
+     * @param max_batch_size  Largest number of samples per micro-batch
+     * @param queue_depth  Number of activation slots between consecutive stages
+     */
+    explicit
+    Parameters(SizeType stages = 2, SizeType max_batch_size = 1, SizeType queue_depth = 2);
+  };
+
+  /**
+   * @brief Setup constructor
+   * @param config  pipeline configuration struct
+   */
+  explicit
+  Pipeline(const Parameters& config = Parameters());
+
+  /**
+   * @brief Stops stage threads; micro-batches still in flight are dropped
+   */
+  ~Pipeline();
+
+  /**
+   * @brief Partitions a chain network into stages and starts stage threads
+   * @param layers  initialized layers, in forward-pass order, each (except the first) fed only
+   *                by the layer before it
+   * @retval true  if all layers support stateless forward propagation
+   * @retval false  otherwise
+   */
+  bool compile(const LayerSequence& layers);
+
+  /**
+   * @brief Queues a micro-batch, if an input slot is free
+   * @param input  column-major <code>inputSize() x count</code> block
+   * @param count  number of samples (at most <code>max_batch_size</code>)
+   * @retval true  if the micro-batch was queued
+   * @retval false  if all input slots are in use
+   */
+  bool tryPush(const ValueType* input, SizeType count);
+
+  /**
+   * @brief Queues a micro-batch, waiting for a free input slot
+   * @see   tryPush
+   */
+  void push(const ValueType* input, SizeType count);
+
+  /**
+   * @brief Takes the oldest finished micro-batch, if one is ready
+   * @param[out] output  column-major block with room for <code>outputSize() x max_batch_size</code>
+   * @param[out] count  number of samples written; <code>0</code> if a layer failed to evaluate the
+   *                    micro-batch, in which case nothing is written
+   * @retval true  if a micro-batch was taken
+   * @retval false  if no micro-batch is ready
+   */
+  bool tryPop(ValueType* output, SizeType& count);
+
+  /**
+   * @brief Takes the oldest finished micro-batch, waiting until one is ready
+   * @param[out] output  column-major block with room for <code>outputSize() x max_batch_size</code>
+   * @return number of samples written; <code>0</code> if a layer failed to evaluate the micro-batch
+   */
+  SizeType pop(ValueType* output);
+
+  /**
+   * @brief Returns number of stages (threads)
+   */
+  inline std::size_t stageCount() const
+  {
+    return stages_.size();
+  }
+
+  /**
+   * @brief Returns number of layers evaluated by a stage
+   */
+  inline std::size_t stageSize(std::size_t s) const
+  {
+    return stages_[s].layers.size();
+  }
+
+  /**
+   * @brief Returns network input size
+   */
+  inline SizeType inputSize() const
+  {
+    return input_size_;
+  }
+
+  /**
+   * @brief Returns network output size
+   */
+  inline SizeType outputSize() const
+  {
+    return output_size_;
+  }
+
+private:
+  Pipeline(const Pipeline&);
+  Pipeline& operator=(const Pipeline&);
+
+  /// Activation slot (one sample per column)
+  struct Slot
+  {
+    aligned::Buffer<ValueType> data;
+    SizeType count;
+
+    /// Flags that a layer failed to evaluate the micro-batch (later stages skip it)
+    bool failed;
+  };
+
+  /// Queue of activation slots between stages
+  typedef internal::SpscQueue<Slot> Queue;
+
+  /// Layers run by one thread
+  struct Stage
+  {
+    std::vector<const LayerType*> layers;
+    SizeType input_rows;
+    SizeType max_rows;
+    Queue* input;
+    Queue* output;
+  };
+
+  /// Stage thread loop
+  void run(std::size_t s);
+
+  /// Stops and joins stage threads
+  void stop();
+
+  /// Pipeline configuration parameters
+  Parameters config_;
+
+  /// Pipelined layers (keeps parameters alive)
+  LayerSequence layers_;
+
+  /// Stages, in order
+  std::vector<Stage> stages_;
+
+  /// Activation slot queues (first feeds the first stage, last is fed by the last stage)
+  std::vector<std::unique_ptr<Queue>> queues_;
+
+  /// Stage threads
+  std::vector<std::thread> threads_;
+
+  /// Flags stage thread shutdown
+  std::atomic<bool> stopping_;
+
+  /// Network input size
+  SizeType input_size_;
+
+  /// Network output size
+  SizeType output_size_;
+};
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/pipeline.hpp>
+#endif  // FFNN_NETWORK_PIPELINE_H
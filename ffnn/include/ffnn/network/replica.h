@@ -0,0 +1,34 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_REPLICA_H
+#define FFNN_NETWORK_REPLICA_H
+
+// C++ Standard Library
+#include <vector>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/layer.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Ties the parameters of network replicas to those of the first replica
+ * @param replicas  identically built networks (layers in forward-pass order), each connected and
+ *                  initialized; the first replica owns the shared parameters
+ * @retval true  if replicas match and all parameterized layers share parameters
+ * @retval false  otherwise
+ * @see   layer::Layer::shareParameters
+ */
+template<typename LayerSequence>
+bool shareParameters(const std::vector<LayerSequence>& replicas);
+}  // namespace network
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/network/impl/replica.hpp>
+#endif  // FFNN_NETWORK_REPLICA_H
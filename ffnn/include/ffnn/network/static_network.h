@@ -0,0 +1,187 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_STATIC_NETWORK_H
+#define FFNN_NETWORK_STATIC_NETWORK_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/network/static_stage.h>
+
+namespace ffnn
+{
+namespace network
+{
+namespace internal
+{
+/**
+ * @brief Checks that each stage's output size matches the next stage's input size
+ */
+template<typename... StageTypes>
+struct ShapesMatch;
+
+template<typename StageType>
+struct ShapesMatch<StageType>
+{
+  static constexpr bool value = true;
+};
+
+template<typename StageType, typename NextStageType, typename... StageTypes>
+struct ShapesMatch<StageType, NextStageType, StageTypes...>
+{
+  static constexpr bool value =
+    (static_cast<int>(StageType::Outputs) == static_cast<int>(NextStageType::Inputs)) &&
+    ShapesMatch<NextStageType, StageTypes...>::value;
+};
+
+/**
+ * @brief Checks that each stage computes with scalars of type <code>ValueType</code>
+ */
+template<typename ValueType, typename... StageTypes>
+struct ScalarsMatch;
+
+template<typename ValueType>
+struct ScalarsMatch<ValueType>
+{
+  static constexpr bool value = true;
+};
+
+template<typename ValueType, typename StageType, typename... StageTypes>
+struct ScalarsMatch<ValueType, StageType, StageTypes...>
+{
+  static constexpr bool value =
+    std::is_same<ValueType, typename StageType::InputVector::Scalar>::value &&
+    ScalarsMatch<ValueType, StageTypes...>::value;
+};
+
+/**
+ * @brief Unrolled forward pass over stages <code>Index</code> through <code>Count - 1</code>
+ */
+template<std::size_t Index, std::size_t Count>
+struct ForwardPass
+{
+  template<typename StageTuple, typename OutputTuple, typename InputVector>
+  static EIGEN_STRONG_INLINE void run(StageTuple& stages, OutputTuple& outputs, const InputVector& input)
+  {
+    std::get<Index>(stages).forward(input, std::get<Index>(outputs));
+    ForwardPass<Index + 1, Count>::run(stages, outputs, std::get<Index>(outputs));
+  }
+};
+
+template<std::size_t Count>
+struct ForwardPass<Count, Count>
+{
+  template<typename StageTuple, typename OutputTuple, typename InputVector>
+  static EIGEN_STRONG_INLINE void run(StageTuple&, OutputTuple&, const InputVector&) {}
+};
+
+/**
+ * @brief Copies layer parameters into stages, starting at stage <code>Index</code>
+ */
+template<std::size_t Index, typename StageTuple>
+inline void copyLayers(StageTuple& stages) {}
+
+template<std::size_t Index, typename StageTuple, typename LayerType, typename... LayerTypes>
+inline void copyLayers(StageTuple& stages, const LayerType& layer, const LayerTypes&... layers)
+{
+  std::get<Index>(stages).copy(layer);
+  copyLayers<Index + 1>(stages, layers...);
+}
+}  // namespace internal
+
+/**
+ * @brief A feed-forward chain of fixed-size layers, composed at compile-time
+ *
+ *        <code>LayerTypes</code> are regular layer types with fixed sizes, i.e.
+ *        <code>layer::FullyConnected<float, 4, 8></code>. Each is replaced by its
+ *        <code>StaticStage</code>, so the forward pass runs on fixed-size Eigen types with
+ *        no virtual dispatch and no heap allocation. Mismatched layer sizes, or layers whose
+ *        scalar type is not <code>ValueType</code>, fail to compile.
+ *
+ * @note  Inference only; train with the regular layer graph and <code>copy</code> the result
+ */
+template<typename ValueType, typename... LayerTypes>
+class StaticNetwork
+{
+public:
+  static_assert(sizeof...(LayerTypes) > 0, "Static network must have at least one layer.");
+
+  /// Stage tuple type standardization
+  typedef std::tuple<StaticStage<LayerTypes>...> StageTuple;
+
+  /// Stage output tuple type standardization
+  typedef std::tuple<typename StaticStage<LayerTypes>::OutputVector...> OutputTuple;
+
+  static_assert(internal::ShapesMatch<StaticStage<LayerTypes>...>::value,
+                "Static network layer sizes do not match.");
+
+  static_assert(internal::ScalarsMatch<ValueType, StaticStage<LayerTypes>...>::value,
+                "Static network layer scalar types do not match the network scalar type.");
+
+  /// Scalar type standardization
+  typedef ValueType ScalarType;
+
+  /// Number of stages
+  static constexpr std::size_t Size = sizeof...(LayerTypes);
+
+  /// Network input type standardization
+  typedef typename std::tuple_element<0, StageTuple>::type::InputVector InputVector;
+
+  /// Network output type standardization
+  typedef typename std::tuple_element<Size - 1, OutputTuple>::type OutputVector;
+
+  /**
+   * @brief Copies parameters from (trained) layers, one per stage, in order
+   */
+  inline void copy(const LayerTypes&... layers)
+  {
+    internal::copyLayers<0>(stages_, layers...);
+  }
+
+  /**
+   * @brief Computes network outputs
+   * @param input  network input vector
+   * @return network output vector
+   */
+  EIGEN_STRONG_INLINE const OutputVector& forward(const InputVector& input)
+  {
+    internal::ForwardPass<0, Size>::run(stages_, outputs_, input);
+    return std::get<Size - 1>(outputs_);
+  }
+
+  /**
+   * @brief Exposes stage at <code>Index</code>
+   */
+  template<std::size_t Index>
+  inline typename std::tuple_element<Index, StageTuple>::type& stage()
+  {
+    return std::get<Index>(stages_);
+  }
+
+  /**
+   * @brief Exposes stage at <code>Index</code> (const)
+   */
+  template<std::size_t Index>
+  inline const typename std::tuple_element<Index, StageTuple>::type& stage() const
+  {
+    return std::get<Index>(stages_);
+  }
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+private:
+  /// Network stages
+  StageTuple stages_;
+
+  /// Per-stage outputs
+  OutputTuple outputs_;
+};
+}  // namespace network
+}  // namespace ffnn
+#endif  // FFNN_NETWORK_STATIC_NETWORK_H
@@ -0,0 +1,160 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NETWORK_STATIC_STAGE_H
+#define FFNN_NETWORK_STATIC_STAGE_H
+
+// C++ Standard Library
+#include <array>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/fully_connected_activation.h>
+
+namespace ffnn
+{
+namespace network
+{
+/**
+ * @brief Inference-only, fixed-size counterpart of a layer type
+ *
+ *        Stages hold their parameters by value in fixed-size Eigen types and have no virtual
+ *        members, so a chain of stages can be fully inlined.
+ *
+ * @note  Specialized for each supported layer type
+ */
+template<typename LayerType>
+struct StaticStage;
+
+/**
+ * @brief Fixed-size FullyConnected stage
+ */
+template<typename ValueType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+struct StaticStage<layer::FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>>
+{
+  static_assert(InputsAtCompileTime > 0 && OutputsAtCompileTime > 0,
+                "Static network layers must have fixed sizes.");
+
+  /// Layer type standardization
+  typedef layer::FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime> LayerType;
+
+  /// Stage sizes
+  enum { Inputs = InputsAtCompileTime, Outputs = OutputsAtCompileTime };
+
+  /// Stage input type standardization
+  typedef Eigen::Matrix<ValueType, Inputs, 1> InputVector;
+
+  /// Stage output type standardization
+  typedef Eigen::Matrix<ValueType, Outputs, 1> OutputVector;
+
+  /**
+   * @brief Copies parameters from a (trained) layer
+   */
+  inline void copy(const LayerType& layer)
+  {
+    w = layer.getWeights();
+    b = layer.getBiases();
+  }
+
+  /**
+   * @brief Computes stage outputs
+   */
+  EIGEN_STRONG_INLINE void forward(const InputVector& input, OutputVector& output)
+  {
+    output.noalias() = w * input;
+    output += b;
+  }
+
+  /// Weight matrix
+  typename LayerType::WeightMatrix w;
+
+  /// Bias vector
+  typename LayerType::BiasVector b;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/**
+ * @brief Fixed-size Activation stage
+ */
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE SizeAtCompileTime>
+struct StaticStage<layer::Activation<ValueType, NeuronType, SizeAtCompileTime>>
+{
+  static_assert(SizeAtCompileTime > 0, "Static network layers must have fixed sizes.");
+
+  /// Layer type standardization
+  typedef layer::Activation<ValueType, NeuronType, SizeAtCompileTime> LayerType;
+
+  /// Stage sizes
+  enum { Inputs = SizeAtCompileTime, Outputs = SizeAtCompileTime };
+
+  /// Stage input type standardization
+  typedef Eigen::Matrix<ValueType, Inputs, 1> InputVector;
+
+  /// Stage output type standardization
+  typedef Eigen::Matrix<ValueType, Outputs, 1> OutputVector;
+
+  /**
+   * @brief Passthrough (activations have no parameters)
+   */
+  inline void copy(const LayerType& layer) {}
+
+  /**
+   * @brief Computes stage outputs
+   */
+  EIGEN_STRONG_INLINE void forward(const InputVector& input, OutputVector& output)
+  {
+    for (FFNN_SIZE_TYPE idx = 0; idx < Outputs; idx++)
+    {
+      neurons[idx].fn(input(idx), output(idx));
+    }
+  }
+
+  /// Stage activation units
+  std::array<NeuronType<ValueType>, SizeAtCompileTime> neurons;
+};
+
+/**
+ * @brief Fixed-size FullyConnectedActivation stage
+ */
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE InputsAtCompileTime,
+         FFNN_SIZE_TYPE OutputsAtCompileTime>
+struct StaticStage<layer::FullyConnectedActivation<ValueType, NeuronType, InputsAtCompileTime, OutputsAtCompileTime>> :
+  StaticStage<layer::FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>>
+{
+  /// Base type alias
+  using Base = StaticStage<layer::FullyConnected<ValueType, InputsAtCompileTime, OutputsAtCompileTime>>;
+
+  /// Stage input type standardization
+  typedef typename Base::InputVector InputVector;
+
+  /// Stage output type standardization
+  typedef typename Base::OutputVector OutputVector;
+
+  /**
+   * @brief Computes stage outputs
+   */
+  EIGEN_STRONG_INLINE void forward(const InputVector& input, OutputVector& output)
+  {
+    Base::forward(input, output);
+    for (FFNN_SIZE_TYPE idx = 0; idx < Base::Outputs; idx++)
+    {
+      neurons[idx].fn(output(idx), output(idx));
+    }
+  }
+
+  /// Stage activation units
+  std::array<NeuronType<ValueType>, OutputsAtCompileTime> neurons;
+};
+}  // namespace network
+}  // namespace ffnn
+#endif  // FFNN_NETWORK_STATIC_STAGE_H
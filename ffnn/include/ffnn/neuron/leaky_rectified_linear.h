@@ -55,10 +55,27 @@ public:
     output = (input > 0) ? 1 : leak_factor_;
   }
 
+  /**
+   * @brief Returns first-order activation derivative
+   * @param positive  true if the input is positive
+   */
+  static constexpr ValueType slope(bool positive)
+  {
+    return positive ? static_cast<ValueType>(1) : static_cast<ValueType>(_P)/static_cast<ValueType>(_B);
+  }
+
 protected:
   /// Factor in the range [0, 1] to leak when (input < 0)
   const ValueType leak_factor_;
 };
+
+/// Leaky-rectified linear units have a binary derivative
+template<typename ValueType,
+         FFNN_SIZE_TYPE _P,
+         FFNN_SIZE_TYPE _B>
+struct HasBinaryDerivative<LeakyRectifiedLinear<ValueType, _P, _B>> :
+  std::true_type
+{};
 }  // namespace neuron
 }  // namespace ffnn
 #endif  // FFNN_NEURON_LEAKY_RECTIFIED_LINEAR_H
@@ -0,0 +1,145 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_NEURON_MODIFIER_INVERTED_DROPOUT_H
+#define FFNN_NEURON_MODIFIER_INVERTED_DROPOUT_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+// FFNN
+#include <ffnn/config/global.h>
+#include <ffnn/neuron/neuron.h>
+
+namespace ffnn
+{
+namespace neuron
+{
+namespace modifier
+{
+/**
+ * @brief Marks neuron types whose outputs are masked by their layer, as a whole
+ * @see   InvertedDropout
+ */
+struct LayerDropout
+{};
+
+/**
+ * @brief Inverted dropout
+ *
+ *        Applied by <code>layer::Activation</code> to all layer outputs at once. In training mode,
+ *        each output is dropped with probability <code>_P/_B</code>, and surviving outputs are
+ *        scaled by <code>_B/(_B - _P)</code>, so that expected activations match those of
+ *        evaluation mode. In evaluation mode (and in stateless forward propagation), activations
+ *        are exactly those of <code>NeuronType</code>.
+ *
+ *        Unlike <code>Dropout</code>, neurons hold no state and draw no random values.
+ */
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE _P,
+         FFNN_SIZE_TYPE _B = 100>
+class InvertedDropout :
+  public NeuronType<ValueType>,
+  public LayerDropout
+{
+  static_assert(_P < _B, "Dropout probability must be less than one.");
+public:
+  /**
+   * @brief Returns probability of dropping an output
+   */
+  static constexpr ValueType probability()
+  {
+    return static_cast<ValueType>(_P) / static_cast<ValueType>(_B);
+  }
+
+  /**
+   * @brief Returns scaling of surviving outputs
+   */
+  static constexpr ValueType scale()
+  {
+    return static_cast<ValueType>(_B) / static_cast<ValueType>(_B - _P);
+  }
+
+  /**
+   * @brief Generates a dropout mask
+   * @param[out] mask  <code>size</code> mask values, each either <code>0</code> or <code>scale()</code>
+   * @param size  number of mask values
+   * @param seed  random stream seed
+   * @param[in,out] sequence  position in random stream; advanced by <code>size</code>
+   * @note  Each value is a hash of its stream position, so the loop has no carried dependencies
+   *        and is vectorized
+   */
+  static void mask(ValueType* mask, std::size_t size, std::uint32_t seed, std::uint32_t& sequence)
+  {
+    const std::uint32_t threshold = dropThreshold();
+    const ValueType survivor = scale();
+    for (std::size_t idx = 0; idx < size; idx++)
+    {
+      mask[idx] = (hash((sequence + static_cast<std::uint32_t>(idx)) ^ seed) < threshold) ? 0 : survivor;
+    }
+    sequence += static_cast<std::uint32_t>(size);
+  }
+
+  /**
+   * @brief Applies an independent dropout mask to each of several samples, in place
+   * @param[in,out] values  first element of a column-major <code>size x count</code> block
+   * @param size  number of values per sample
+   * @param stride  distance between consecutive samples
+   * @param count  number of samples
+   * @param seed  random stream seed
+   * @param pass  pass identifier; passes with distinct identifiers draw distinct masks
+   */
+  static void apply(ValueType* values,
+                    std::size_t size,
+                    std::size_t stride,
+                    std::size_t count,
+                    std::uint32_t seed,
+                    std::uint32_t pass)
+  {
+    const std::uint32_t threshold = dropThreshold();
+    const ValueType survivor = scale();
+    std::uint32_t sequence = hash(pass ^ seed);
+    for (std::size_t col = 0; col < count; col++, sequence += static_cast<std::uint32_t>(size))
+    {
+      ValueType* v = values + col * stride;
+      for (std::size_t idx = 0; idx < size; idx++)
+      {
+        v[idx] *= (hash((sequence + static_cast<std::uint32_t>(idx)) ^ seed) < threshold) ? 0 : survivor;
+      }
+    }
+  }
+
+private:
+  /// Returns hashed stream values below which outputs are dropped
+  static constexpr std::uint32_t dropThreshold()
+  {
+    return static_cast<std::uint32_t>(static_cast<double>(_P) / static_cast<double>(_B) * 4294967296.0);
+  }
+
+  /// Maps a stream position to a uniformly distributed value
+  static inline std::uint32_t hash(std::uint32_t x)
+  {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+  }
+};
+}  // namespace modifier
+
+/// Inverted dropout masks errors at the layer level, and keeps the derivative of its neuron type
+template<typename ValueType,
+         template<class> class NeuronType,
+         FFNN_SIZE_TYPE _P,
+         FFNN_SIZE_TYPE _B>
+struct HasBinaryDerivative<modifier::InvertedDropout<ValueType, NeuronType, _P, _B>> :
+  HasBinaryDerivative<NeuronType<ValueType>>
+{};
+}  // namespace neuron
+}  // namespace ffnn
+#endif  // FFNN_NEURON_MODIFIER_INVERTED_DROPOUT_H
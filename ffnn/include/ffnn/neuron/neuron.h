@@ -5,6 +5,9 @@
 #ifndef FFNN_NEURON_NEURON_H
 #define FFNN_NEURON_NEURON_H
 
+// C++ Standard Library
+#include <type_traits>
+
 namespace ffnn
 {
 namespace neuron
@@ -30,6 +33,20 @@ public:
    */
   virtual void derivative(const ValueType& input, ValueType& output) const = 0;
 };
+
+/**
+ * @brief Flags neuron types whose derivative takes one of two values, selected by the sign of the input
+ *
+ *        Flagged types provide <code>static ValueType slope(bool positive)</code>, so layers may keep
+ *        one bit per unit for back-propagation, instead of unit inputs.
+ *
+ * @note  Specialized for each exact neuron type; neuron types which derive from a flagged type (e.g.
+ *        stateful dropout modifiers) may change its derivative, and are not flagged
+ */
+template<typename NeuronType>
+struct HasBinaryDerivative :
+  std::false_type
+{};
 }  // namespace neuron
 }  // namespace ffnn
 #endif  // FFNN_NEURON_NEURON_H
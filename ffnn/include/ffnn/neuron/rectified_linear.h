@@ -39,7 +39,22 @@ public:
   {
     output = (input > 0) ? 1 : 0;
   }
+
+  /**
+   * @brief Returns first-order activation derivative
+   * @param positive  true if the input is positive
+   */
+  static constexpr ValueType slope(bool positive)
+  {
+    return positive ? 1 : 0;
+  }
 };
+
+/// Rectified linear units have a binary derivative
+template<typename ValueType>
+struct HasBinaryDerivative<RectifiedLinear<ValueType>> :
+  std::true_type
+{};
 }  // namespace neuron
 }  // namespace ffnn
 #endif  // FFNN_NEURON_RECTIFIED_LINEAR_H
@@ -13,6 +13,7 @@
 #include <ffnn/optimizer/fwd.h>
 
 /// FFNN (specializations)
+#include <ffnn/optimizer/impl/adam/embedding.hpp>
 #include <ffnn/optimizer/impl/adam/fully_connected.hpp>
 #include <ffnn/optimizer/impl/adam/sparsely_connected.hpp>
 
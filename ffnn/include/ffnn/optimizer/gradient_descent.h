@@ -12,6 +12,7 @@
 #include <ffnn/optimizer/fwd.h>
 
 /// FFNN (specializations)
+#include <ffnn/optimizer/impl/gradient_descent/embedding.hpp>
 #include <ffnn/optimizer/impl/gradient_descent/fully_connected.hpp>
 #include <ffnn/optimizer/impl/gradient_descent/sparsely_connected.hpp>
 
@@ -5,6 +5,9 @@
 #ifndef FFNN_LAYER_OPTIMIZATION_ADAM_STATES_HPP
 #define FFNN_LAYER_OPTIMIZATION_ADAM_STATES_HPP
 
+// FFNN
+#include <ffnn/aligned_types.h>
+
 namespace ffnn
 {
 namespace optimizer
@@ -13,8 +16,13 @@ template<typename MatrixType>
 class AdamStates
 {
 public:
+  /// Scalar type standardization
+  typedef typename MatrixType::Scalar ScalarType;
+
+  /// Size type standardization
+  typedef typename MatrixType::Index SizeType;
 
-  void update(MatrixType& gradient, ScalarType beta1, ScalarType beta2, ScalarType eps)
+  void update(aligned::Map<MatrixType>& gradient, ScalarType beta1, ScalarType beta2, ScalarType eps)
   {
     // Update gradient moments
     mean_ += beta1 * (gradient - mean_);
@@ -30,16 +38,25 @@ public:
 
   inline void initialize(SizeType rows, SizeType col)
   {
-    mean_.setZero(rows, col);
-    var_.setZero(rows, col);
+    mean_buffer_.assign(rows * col, ScalarType(0));
+    mean_.remap(mean_buffer_.data(), rows, col);
+    var_buffer_.assign(rows * col, ScalarType(0));
+    var_.remap(var_buffer_.data(), rows, col);
   }
 
 private:
-  /// Running mean of error gradient
-  MatrixType mean_;
+  /// Running mean of error gradient data
+  aligned::Buffer<ScalarType> mean_buffer_;
 
-  /// Uncentered variance of error gradient
-  MatrixType var_;
-};
+  /// Running mean of error gradient (view of <code>mean_buffer_</code>)
+  aligned::Map<MatrixType> mean_;
 
+  /// Uncentered variance of error gradient data
+  aligned::Buffer<ScalarType> var_buffer_;
+
+  /// Uncentered variance of error gradient (view of <code>var_buffer_</code>)
+  aligned::Map<MatrixType> var_;
+};
+}  // namespace optimizer
+}  // namespace ffnn
 #endif  // FFNN_LAYER_OPTIMIZATION_ADAM_STATES_HPP
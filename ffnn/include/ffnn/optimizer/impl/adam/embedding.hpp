@@ -0,0 +1,142 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <cmath>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+#include <ffnn/layer/embedding.h>
+
+namespace ffnn
+{
+namespace optimizer
+{
+/**
+ * @brief Lazy Adam over the embeddings of ids seen since the last update
+ *
+ *        Moment estimates of an embedding are only decayed and updated, and the embedding is only
+ *        moved, when its id has an accumulated gradient. Bias correction uses the global update count.
+ */
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+class Adam<layer::Embedding<ValueType, EmbeddingsAtCompileTime>>:
+  public GradientDescent<layer::Embedding<ValueType, EmbeddingsAtCompileTime>>
+{
+public:
+  /// Base type standardization
+  typedef GradientDescent<layer::Embedding<ValueType, EmbeddingsAtCompileTime>> Base;
+
+  /// Layer type standardization
+  typedef typename layer::Embedding<ValueType, EmbeddingsAtCompileTime> LayerType;
+
+  /// Scalar type standardization
+  typedef typename LayerType::ScalarType ScalarType;
+
+  /// Size type standardization
+  typedef typename LayerType::SizeType SizeType;
+
+  /// Embedding table type standardization
+  typedef typename LayerType::TableMatrix TableMatrix;
+
+  /**
+   * @brief Setup constructor
+   * @param lr  Learning rate
+   * @param beta1  mean decay rate
+   * @param beta2  variance decay rate
+   * @param eps  variance normalization value
+   */
+  explicit
+  Adam(ScalarType lr, ScalarType beta1 = 0.9, ScalarType beta2 = 0.999, ScalarType eps = 1e-8) :
+    Base(lr),
+    beta1_(beta1),
+    beta2_(beta2),
+    epsilon_(eps),
+    step_(0)
+  {
+    Base::setName("Adam[Embedding]");
+    FFNN_ASSERT_MSG(beta1_ > 0 && beta1_ < 1, "'beta1' should be in the range (0, 1).");
+    FFNN_ASSERT_MSG(beta2_ > 0 && beta2_ < 1, "'beta2' should be in the range (0, 1).");
+    FFNN_ASSERT_MSG(epsilon_ > 0, "Epsilon should be > 0.");
+  }
+  virtual ~Adam() {}
+
+  /**
+   * @brief Initializes the Optimizer
+   * @param[in, out] layer  Layer to optimize
+   */
+  void initialize(LayerType& layer)
+  {
+    Base::initialize(layer);
+
+    // Reset states
+    const SizeType rows = layer.embeddingSize();
+    const SizeType cols = layer.vocabularySize();
+    mean_buffer_.assign(rows * cols, ScalarType(0));
+    mean_.remap(mean_buffer_.data(), rows, cols);
+    var_buffer_.assign(rows * cols, ScalarType(0));
+    var_.remap(var_buffer_.data(), rows, cols);
+    step_ = 0;
+  }
+
+  /**
+   * @brief Applies optimization update
+   * @param[in, out] layer  Layer to optimize
+   * @retval true  if optimization update was applied successfully
+   * @retval false  otherwise
+   */
+  bool update(LayerType& layer)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    // Learning rate with moment bias correction
+    step_++;
+    const ScalarType lr = Base::lr_ *
+                          std::sqrt(1 - std::pow(beta2_, static_cast<ScalarType>(step_))) /
+                          (1 - std::pow(beta1_, static_cast<ScalarType>(step_)));
+
+    // Update moments and embeddings of touched ids only
+    for (std::size_t idx = 0; idx < Base::touched_.size(); idx++)
+    {
+      const SizeType id = Base::touched_[idx];
+      const auto gradient = Base::gradientAt(idx);
+      mean_.col(id) = beta1_ * mean_.col(id) + (1 - beta1_) * gradient;
+      var_.col(id) = beta2_ * var_.col(id) + (1 - beta2_) * gradient.cwiseAbs2();
+      layer.table_.col(id).array() -= lr * mean_.col(id).array() / (var_.col(id).array().sqrt() + epsilon_);
+    }
+
+    // Reinitialize optimizer
+    Base::reset(layer);
+    return true;
+  }
+
+private:
+  /// Mean decay rate
+  const ScalarType beta1_;
+
+  /// Variance decay rate
+  const ScalarType beta2_;
+
+  /// Variance normalization value
+  const ScalarType epsilon_;
+
+  /// Number of applied updates
+  std::size_t step_;
+
+  /// Running mean of embedding gradients data
+  aligned::Buffer<ScalarType> mean_buffer_;
+
+  /// Running mean of embedding gradients (view of <code>mean_buffer_</code>)
+  aligned::Map<TableMatrix> mean_;
+
+  /// Running uncentered variance of embedding gradients data
+  aligned::Buffer<ScalarType> var_buffer_;
+
+  /// Running uncentered variance of embedding gradients (view of <code>var_buffer_</code>)
+  aligned::Map<TableMatrix> var_;
+};
+}  // namespace optimizer
+}  // namespace ffnn
@@ -96,7 +96,7 @@ public:
     current_gradient *= Base::lr_;
 
     // Update weights
-    layer.w_ -= current_gradient;
+    *layer.w_ -= current_gradient;
 
     // Reinitialize optimizer
     Base::reset(layer);
@@ -0,0 +1,227 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+// C++ Standard Library
+#include <vector>
+
+// FFNN
+#include <ffnn/assert.h>
+#include <ffnn/logging.h>
+#include <ffnn/layer/embedding.h>
+
+namespace ffnn
+{
+namespace optimizer
+{
+/**
+ * @brief Gradient descent over the embeddings of ids seen since the last update
+ *
+ *        Gradients are accumulated as a list of touched ids and one gradient per touched id, so
+ *        memory and update cost scale with the number of distinct ids per update, not the vocabulary.
+ */
+template<typename ValueType, FFNN_SIZE_TYPE EmbeddingsAtCompileTime>
+class GradientDescent<layer::Embedding<ValueType, EmbeddingsAtCompileTime>>:
+  public Optimizer<layer::Embedding<ValueType, EmbeddingsAtCompileTime>>
+{
+public:
+  /// Layer type standardization
+  typedef typename layer::Embedding<ValueType, EmbeddingsAtCompileTime> LayerType;
+
+  /// Scalar type standardization
+  typedef typename LayerType::ScalarType ScalarType;
+
+  /// Size type standardization
+  typedef typename LayerType::SizeType SizeType;
+
+  /// Embedding vector type standardization
+  typedef typename LayerType::EmbeddingVector EmbeddingVector;
+
+  /**
+   * @brief Setup constructor
+   * @param lr  Learning rate
+   */
+  explicit
+  GradientDescent(ScalarType lr) :
+    Optimizer<LayerType>("GradientDescent[Embedding]"),
+    lr_(lr),
+    embedding_size_(0)
+  {}
+  virtual ~GradientDescent() {}
+
+  /**
+   * @brief Initializes the Optimizer
+   * @param[in, out] layer  Layer to optimize
+   */
+  virtual void initialize(LayerType& layer)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+    embedding_size_ = layer.embeddingSize();
+    slot_.assign(layer.vocabularySize(), -1);
+    reset(layer);
+
+    // Reset previous ids
+    prev_ids_.assign(layer.inputSize(), 0);
+  }
+
+  /**
+   * @brief Resetrs persistent Optimizer states
+   * @param[in, out] layer  Layer to optimize
+   */
+  virtual void reset(LayerType& layer)
+  {
+    // Release touched ids
+    for (const auto id : touched_)
+    {
+      slot_[id] = -1;
+    }
+    touched_.clear();
+    gradient_.clear();
+  }
+
+  /**
+   * @brief Computes one forward optimization update step
+   * @param[in, out] layer  Layer to optimize
+   * @retval true  if optimization setp was successful
+   * @retval false  otherwise
+   */
+  virtual bool forward(LayerType& layer)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    // Copy current ids for updating
+    for (SizeType idx = 0; idx < layer.inputSize(); idx++)
+    {
+      prev_ids_[idx] = layer.toId(layer.input_(idx));
+    }
+    return true;
+  }
+
+  /**
+   * @brief Computes optimization step during backward propogation
+   * @param[in, out] layer  Layer to optimize
+   * @retval true  if optimization setp was successful
+   * @retval false  otherwise
+   */
+  virtual bool backward(LayerType& layer)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    // Accumulate the error of each looked-up embedding into the gradient of its id
+    for (SizeType idx = 0; idx < layer.inputSize(); idx++)
+    {
+      if (prev_ids_[idx] < 0)
+      {
+        FFNN_ERROR_NAMED("optimizer::GradientDescent", "Cannot compute gradient of an invalid id.");
+        return false;
+      }
+      gradientOf(prev_ids_[idx]) += layer.forward_error_.segment(idx * embedding_size_, embedding_size_);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Applies optimization update
+   * @param[in, out] layer  Layer to optimize
+   * @retval true  if optimization update was applied successfully
+   * @retval false  otherwise
+   */
+  virtual bool update(LayerType& layer)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    // Update embeddings of touched ids (incorporating learning rate)
+    for (std::size_t idx = 0; idx < touched_.size(); idx++)
+    {
+      layer.table_.col(touched_[idx]).noalias() -= lr_ * gradientAt(idx);
+    }
+
+    // Reinitialize optimizer
+    reset(layer);
+    return true;
+  }
+
+  /**
+   * @brief Moves gradients accumulated by another optimizer into this one
+   * @param[in, out] layer  Layer to optimize
+   * @param[in, out] other  GradientDescent optimizer attached to a replica of <code>layer</code>
+   * @retval true  if gradients were merged
+   * @retval false  otherwise
+   */
+  virtual bool merge(LayerType& layer, Optimizer<LayerType>& other)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    GradientDescent* replica = dynamic_cast<GradientDescent*>(&other);
+    if (!replica)
+    {
+      FFNN_ERROR_NAMED("optimizer::GradientDescent", "Cannot merge gradients from " << other.name());
+      return false;
+    }
+
+    // Accumulate replica gradients
+    for (std::size_t idx = 0; idx < replica->touched_.size(); idx++)
+    {
+      gradientOf(replica->touched_[idx]) += replica->gradientAt(idx);
+    }
+
+    // Reinitialize replica optimizer
+    replica->reset(layer);
+    return true;
+  }
+
+  /**
+   * @brief Returns ids with accumulated gradients, in order of first use since the last update
+   */
+  inline const std::vector<SizeType>& getTouchedIds() const
+  {
+    return touched_;
+  }
+
+protected:
+  /// Mutable view of the accumulated gradient of one touched id
+  typedef Eigen::Map<EmbeddingVector> GradientView;
+
+  /**
+   * @brief Exposes the accumulated gradient of the touched id at a position in <code>touched_</code>
+   */
+  inline GradientView gradientAt(std::size_t idx)
+  {
+    return GradientView(gradient_.data() + idx * embedding_size_, embedding_size_);
+  }
+
+  /**
+   * @brief Exposes the accumulated gradient of an id, which is marked as touched if it was not
+   */
+  inline GradientView gradientOf(SizeType id)
+  {
+    if (slot_[id] < 0)
+    {
+      slot_[id] = static_cast<SizeType>(touched_.size());
+      touched_.push_back(id);
+      gradient_.resize(gradient_.size() + embedding_size_, ScalarType(0));
+    }
+    return gradientAt(static_cast<std::size_t>(slot_[id]));
+  }
+
+  /// Learning rate
+  ScalarType lr_;
+
+  /// Number of values per embedding
+  SizeType embedding_size_;
+
+  /// Ids looked up during the previous forward pass
+  std::vector<SizeType> prev_ids_;
+
+  /// Ids with accumulated gradients
+  std::vector<SizeType> touched_;
+
+  /// Accumulated gradients, one embedding-sized segment per touched id
+  std::vector<ScalarType> gradient_;
+
+  /// Position of each id in <code>touched_</code>, or -1 if not touched
+  std::vector<SizeType> slot_;
+};
+}  // namespace optimizer
+}  // namespace ffnn
@@ -3,9 +3,14 @@
  * @warn Do not include directly
  */
 
+// C++ Standard Library
+#include <vector>
+
 // FFNN
+#include <ffnn/aligned_types.h>
 #include <ffnn/assert.h>
 #include <ffnn/logging.h>
+#include <ffnn/cpu/kernels.h>
 #include <ffnn/layer/fully_connected.h>
 
 namespace ffnn
@@ -48,7 +53,9 @@ public:
   explicit
   GradientDescent(ScalarType lr) :
     Optimizer<LayerType>("GradientDescent[FullyConnected]"),
-    lr_(lr)
+    lr_(lr),
+    sparse_input_(false),
+    dense_gradient_(true)
   {}
   virtual ~GradientDescent() {}
 
@@ -63,6 +70,7 @@ public:
 
     // Reset previous input
     prev_input_.setZero(layer.input_dimension_, 1);
+    sparse_input_ = false;
   }
 
   /**
@@ -71,11 +79,27 @@ public:
    */
   virtual void reset(LayerType& layer)
   {
-    // Reset weight delta
-    weight_gradient_.setZero(layer.output_dimension_, layer.input_dimension_);
+    // Reset weight delta; only columns of active inputs were accumulated if all inputs were sparse
+    if (dense_gradient_ || touched_.size() != static_cast<std::size_t>(layer.input_dimension_))
+    {
+      weight_gradient_buffer_.assign(layer.output_dimension_ * layer.input_dimension_, ScalarType(0));
+      weight_gradient_.remap(weight_gradient_buffer_.data(), layer.output_dimension_, layer.input_dimension_);
+      touched_.assign(layer.input_dimension_, false);
+    }
+    else
+    {
+      for (const auto col : touched_columns_)
+      {
+        weight_gradient_.col(col).setZero();
+        touched_[col] = false;
+      }
+    }
+    touched_columns_.clear();
+    dense_gradient_ = false;
 
     // Reset bias delta
-    bias_gradient_.setZero(layer.output_dimension_, 1);
+    bias_gradient_buffer_.assign(layer.output_dimension_, ScalarType(0));
+    bias_gradient_.remap(bias_gradient_buffer_.data(), layer.output_dimension_);
   }
 
   /**
@@ -88,8 +112,22 @@ public:
   {
     FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
 
-    // Copy current input for updating
-    prev_input_.noalias() = *layer.input_;
+    // Copy current input for updating; only active inputs, if inputs are sparse
+    sparse_input_ = layer.hasActiveInputs();
+    if (sparse_input_)
+    {
+      const SizeType* indices = layer.getActiveInputs();
+      active_inputs_.assign(indices, indices + layer.activeInputCount());
+      active_values_.resize(active_inputs_.size());
+      for (std::size_t k = 0; k < active_inputs_.size(); k++)
+      {
+        active_values_[k] = layer.input_(active_inputs_[k]);
+      }
+    }
+    else
+    {
+      prev_input_.noalias() = layer.input_;
+    }
     return true;
   }
 
@@ -104,11 +142,30 @@ public:
     FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
 
     // Compute and accumulate new gradient
-    weight_gradient_.noalias() += (*layer.forward_error_) * prev_input_.transpose();
-    bias_gradient_.noalias() += (*layer.forward_error_);
+    if (sparse_input_)
+    {
+      cpu::scatterRankUpdate(weight_gradient_,
+                             layer.forward_error_,
+                             active_inputs_.data(),
+                             active_values_.data(),
+                             static_cast<SizeType>(active_inputs_.size()));
+      for (const auto col : active_inputs_)
+      {
+        touch(col);
+      }
+    }
+    else
+    {
+      cpu::rankUpdate(weight_gradient_, layer.forward_error_, prev_input_);
+      dense_gradient_ = true;
+    }
+    cpu::axpy(ScalarType(1), layer.forward_error_, bias_gradient_);
 
     // Compute back-propagated error
-    layer.backward_error_->noalias() = layer.w_.transpose() * (*layer.forward_error_);
+    if (layer.hasBackwardError())
+    {
+      cpu::transposeProduct(layer.w_, layer.forward_error_, layer.backward_error_);
+    }
     return true;
   }
 
@@ -122,31 +179,113 @@ public:
   {
     FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
 
-    // Incorporate learning rate
-    weight_gradient_ *= lr_;
-    bias_gradient_ *= lr_;
-
-    // Update weights
-    layer.w_.noalias() -= weight_gradient_;
-    layer.b_.noalias() -= bias_gradient_;
+    // Update weights (incorporating learning rate); only touched columns, if inputs were sparse
+    if (dense_gradient_)
+    {
+      cpu::axpy(-lr_, weight_gradient_, layer.w_);
+    }
+    else
+    {
+      for (const auto col : touched_columns_)
+      {
+        layer.w_.col(col).noalias() -= lr_ * weight_gradient_.col(col);
+      }
+    }
+    cpu::axpy(-lr_, bias_gradient_, layer.b_);
 
     // Reinitialize optimizer
     reset(layer);
     return true;
   }
 
+  /**
+   * @brief Moves gradients accumulated by another optimizer into this one
+   * @param[in, out] layer  Layer to optimize
+   * @param[in, out] other  GradientDescent optimizer attached to a replica of <code>layer</code>
+   * @retval true  if gradients were merged
+   * @retval false  otherwise
+   */
+  virtual bool merge(LayerType& layer, Optimizer<LayerType>& other)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    GradientDescent* replica = dynamic_cast<GradientDescent*>(&other);
+    if (!replica)
+    {
+      FFNN_ERROR_NAMED("optimizer::GradientDescent", "Cannot merge gradients from " << other.name());
+      return false;
+    }
+
+    // Accumulate replica gradients
+    if (replica->dense_gradient_)
+    {
+      cpu::axpy(ScalarType(1), replica->weight_gradient_, weight_gradient_);
+      dense_gradient_ = true;
+    }
+    else
+    {
+      for (const auto col : replica->touched_columns_)
+      {
+        weight_gradient_.col(col) += replica->weight_gradient_.col(col);
+        touch(col);
+      }
+    }
+    cpu::axpy(ScalarType(1), replica->bias_gradient_, bias_gradient_);
+
+    // Reinitialize replica optimizer
+    replica->reset(layer);
+    return true;
+  }
+
 protected:
+  /**
+   * @brief Marks a weight gradient column as accumulated
+   * @param col  input index
+   */
+  inline void touch(SizeType col)
+  {
+    if (!dense_gradient_ && !touched_[col])
+    {
+      touched_[col] = true;
+      touched_columns_.push_back(col);
+    }
+  }
+
   /// Learning rate
   ScalarType lr_;
 
-  /// Total weight matrix gradient
-  WeightMatrix weight_gradient_;
+  /// Total weight matrix gradient data
+  aligned::Buffer<ScalarType> weight_gradient_buffer_;
+
+  /// Total weight matrix gradient (view of <code>weight_gradient_buffer_</code>)
+  aligned::Map<WeightMatrix> weight_gradient_;
+
+  /// Total bias vector delta data
+  aligned::Buffer<ScalarType> bias_gradient_buffer_;
 
-  /// Total bias vector delta
-  BiasVector bias_gradient_;
+  /// Total bias vector delta (view of <code>bias_gradient_buffer_</code>)
+  aligned::Map<BiasVector> bias_gradient_;
 
   /// Previous input
   InputVector prev_input_;
+
+  /// Flags if the previous input was sparse
+  bool sparse_input_;
+
+  /// Indices of previous active inputs
+  std::vector<SizeType> active_inputs_;
+
+  /// Values of previous active inputs
+  std::vector<ScalarType> active_values_;
+
+  /// Flags if any weight gradient was accumulated from dense inputs
+  bool dense_gradient_;
+
+  /// Flags weight gradient columns accumulated from sparse inputs
+  std::vector<bool> touched_;
+
+  /// Indices of weight gradient columns accumulated from sparse inputs
+  std::vector<SizeType> touched_columns_;
 };
 }  // namespace optimizer
 }  // namespace ffnn
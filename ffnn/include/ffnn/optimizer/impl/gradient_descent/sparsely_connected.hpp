@@ -3,9 +3,14 @@
  * @warn Do not include directly
  */
 
+// C++ Standard Library
+#include <vector>
+
 // FFNN
+#include <ffnn/aligned_types.h>
 #include <ffnn/assert.h>
 #include <ffnn/logging.h>
+#include <ffnn/cpu/kernels.h>
 #include <ffnn/layer/sparsely_connected.h>
 
 namespace ffnn
@@ -41,6 +46,9 @@ public:
   /// Input-output weight matrix
   typedef typename LayerType::WeightMatrix WeightMatrix;
 
+  /// Weight gradient type standardization (one value per stored weight)
+  typedef Eigen::Matrix<ScalarType, Eigen::Dynamic, 1> WeightGradient;
+
   /**
    * @brief Setup constructor
    * @param lr  Learning rate
@@ -72,10 +80,14 @@ public:
   virtual void reset(LayerType& layer)
   {
     // Reset weight delta
-    weight_gradient_.resize(layer.output_dimension_, layer.input_dimension_);
+    weight_gradient_buffer_.assign(layer.w_->nonZeros(), ScalarType(0));
+    weight_gradient_.remap(weight_gradient_buffer_.data(), layer.w_->nonZeros());
+    touched_.assign(layer.input_dimension_, false);
+    touched_columns_.clear();
 
     // Reset bias delta
-    bias_gradient_.setZero(layer.output_dimension_, 1);
+    bias_gradient_buffer_.assign(layer.output_dimension_, ScalarType(0));
+    bias_gradient_.remap(bias_gradient_buffer_.data(), layer.output_dimension_);
   }
 
   /**
@@ -89,7 +101,7 @@ public:
     FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
 
     // Copy current input for updating
-    prev_input_.noalias() = *layer.input_;
+    prev_input_.noalias() = layer.input_;
     return true;
   }
 
@@ -103,23 +115,34 @@ public:
   {
     FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
 
-    // Compute current weight delta
-    WeightMatrix current_weight_gradient(layer.output_dimension_, layer.input_dimension_);
-    for(SizeType idx = 0; idx < layer.w_.outerSize(); idx++)
+    const WeightMatrix& w = *layer.w_;
+    FFNN_ASSERT_MSG(w.isCompressed() && weight_gradient_.size() == w.nonZeros(),
+                    "Weight sparsity pattern changed since optimizer reset.");
+
+    // Accumulate weight delta of stored weights with non-zero inputs
+    const auto* outer = w.outerIndexPtr();
+    const auto* inner = w.innerIndexPtr();
+    for(SizeType jdx = 0; jdx < w.outerSize(); jdx++)
     {
-      for(typename WeightMatrix::InnerIterator it(layer.w_, idx); it; ++it)
+      const ScalarType x = prev_input_(jdx);
+      if (x != 0)
       {
-        current_weight_gradient.insert(it.row(), it.col()) =
-          (*layer.forward_error_)(it.row()) * prev_input_(it.col());
+        touch(jdx);
+        for(auto kdx = outer[jdx]; kdx < outer[jdx + 1]; kdx++)
+        {
+          weight_gradient_(kdx) += layer.forward_error_(inner[kdx]) * x;
+        }
       }
     }
 
-    // Accumulate weight delta
-    weight_gradient_ += current_weight_gradient;
-    bias_gradient_.noalias() += (*layer.forward_error_);
+    // Accumulate bias delta
+    bias_gradient_.noalias() += layer.forward_error_;
 
     // Compute back-propagated error
-    layer.backward_error_->noalias() = layer.w_.transpose() * (*layer.forward_error_);
+    if (layer.hasBackwardError())
+    {
+      layer.backward_error_.noalias() = w.transpose() * layer.forward_error_;
+    }
     return true;
   }
 
@@ -128,33 +151,108 @@ public:
    * @param[in, out] layer  Layer to optimize
    * @retval true  if optimization update was applied successfully
    * @retval false  otherwise
+   * @note  Only weights in columns which received non-zero inputs since the last update are
+   *        written, in place; the weight sparsity pattern is never changed
    */
   virtual bool update(LayerType& layer)
   {
     FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
 
-    // Incorporate learning rate
-    weight_gradient_ *= lr_;
-    bias_gradient_ *= lr_;
+    WeightMatrix& w = *layer.w_;
+    FFNN_ASSERT_MSG(w.isCompressed() && weight_gradient_.size() == w.nonZeros(),
+                    "Weight sparsity pattern changed since optimizer reset.");
 
-    // Update weights and biases
-    layer.w_ -= weight_gradient_;
-    layer.b_.noalias() -= bias_gradient_;
+    // Update weights (incorporating learning rate) and clear their deltas
+    ScalarType* values = w.valuePtr();
+    const auto* outer = w.outerIndexPtr();
+    for (const auto jdx : touched_columns_)
+    {
+      for(auto kdx = outer[jdx]; kdx < outer[jdx + 1]; kdx++)
+      {
+        values[kdx] -= lr_ * weight_gradient_(kdx);
+        weight_gradient_(kdx) = 0;
+      }
+      touched_[jdx] = false;
+    }
+    touched_columns_.clear();
 
-    // Reinitialize optimizer
-    reset(layer);
+    // Update biases (incorporating learning rate)
+    cpu::axpy(-lr_, bias_gradient_, layer.b_);
+    bias_gradient_.setZero();
+    return true;
+  }
+
+  /**
+   * @brief Moves gradients accumulated by another optimizer into this one
+   * @param[in, out] layer  Layer to optimize
+   * @param[in, out] other  GradientDescent optimizer attached to a replica of <code>layer</code>
+   * @retval true  if gradients were merged
+   * @retval false  otherwise
+   */
+  virtual bool merge(LayerType& layer, Optimizer<LayerType>& other)
+  {
+    FFNN_ASSERT_MSG(layer.isInitialized(), "Layer to optimize is not initialized.");
+
+    GradientDescent* replica = dynamic_cast<GradientDescent*>(&other);
+    if (!replica || replica->weight_gradient_.size() != weight_gradient_.size())
+    {
+      FFNN_ERROR_NAMED("optimizer::GradientDescent", "Cannot merge gradients from " << other.name());
+      return false;
+    }
+
+    // Move replica weight deltas, in order of first touch
+    const auto* outer = layer.w_->outerIndexPtr();
+    for (const auto jdx : replica->touched_columns_)
+    {
+      touch(jdx);
+      for(auto kdx = outer[jdx]; kdx < outer[jdx + 1]; kdx++)
+      {
+        weight_gradient_(kdx) += replica->weight_gradient_(kdx);
+        replica->weight_gradient_(kdx) = 0;
+      }
+      replica->touched_[jdx] = false;
+    }
+    replica->touched_columns_.clear();
+
+    // Move replica bias delta
+    cpu::axpy(ScalarType(1), replica->bias_gradient_, bias_gradient_);
+    replica->bias_gradient_.setZero();
     return true;
   }
 
 protected:
+  /**
+   * @brief Marks a weight column as holding non-zero weight deltas
+   */
+  inline void touch(SizeType jdx)
+  {
+    if (!touched_[jdx])
+    {
+      touched_[jdx] = true;
+      touched_columns_.push_back(jdx);
+    }
+  }
+
   /// Learning rate
   ScalarType lr_;
 
-  /// Weight matrix delta
-  WeightMatrix weight_gradient_;
+  /// Weight matrix delta data
+  aligned::Buffer<ScalarType> weight_gradient_buffer_;
+
+  /// Weight matrix delta, one value per stored weight (view of <code>weight_gradient_buffer_</code>)
+  aligned::Map<WeightGradient> weight_gradient_;
+
+  /// Flags weight columns with non-zero weight deltas
+  std::vector<bool> touched_;
+
+  /// Weight columns with non-zero weight deltas
+  std::vector<SizeType> touched_columns_;
+
+  /// Total bias vector delta data
+  aligned::Buffer<ScalarType> bias_gradient_buffer_;
 
-  /// Total bias vector delta
-  BiasVector bias_gradient_;
+  /// Total bias vector delta (view of <code>bias_gradient_buffer_</code>)
+  aligned::Map<BiasVector> bias_gradient_;
 
   /// Previous input
   InputVector prev_input_;
@@ -78,6 +78,19 @@ public:
    */
   virtual bool update(LayerType& layer) = 0;
 
+  /**
+   * @brief Moves gradients accumulated by another optimizer into this one
+   * @param[in, out] layer  Layer to optimize
+   * @param[in, out] other  optimizer of the same type, attached to a replica of <code>layer</code>;
+   *                        its accumulated gradients are cleared
+   * @retval true  if gradients were merged
+   * @retval false  if the optimizer does not support merging
+   */
+  virtual bool merge(LayerType& layer, Optimizer& other)
+  {
+    return false;
+  }
+
   /**
    * @brief Exposes name of the optimizer
    */
@@ -86,7 +99,7 @@ public:
   /**
    * @brief Sets name of the optimizer
    */
-  inline void setName(const std::string& name) const { name_ = name; }
+  inline void setName(const std::string& name) { name_ = name; }
 
 private:
   /// Name of the optimizer
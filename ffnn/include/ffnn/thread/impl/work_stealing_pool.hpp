@@ -0,0 +1,132 @@
+/**
+ * @note HEADER-ONLY IMPLEMENTATION FILE
+ * @warn Do not include directly
+ */
+
+namespace ffnn
+{
+namespace thread
+{
+inline WorkStealingPool::WorkStealingPool(std::size_t workers) :
+  queued_(0),
+  sleeping_(0),
+  stopping_(false)
+{
+  for (std::size_t tdx = 0; tdx <= workers; tdx++)
+  {
+    queues_.emplace_back(new Queue());
+  }
+  for (std::size_t tdx = 0; tdx < workers; tdx++)
+  {
+    workers_.emplace_back(&WorkStealingPool::work, this, tdx);
+  }
+}
+
+inline WorkStealingPool::~WorkStealingPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_)
+  {
+    worker.join();
+  }
+}
+
+inline std::size_t WorkStealingPool::defaultWorkers()
+{
+  const std::size_t threads = std::thread::hardware_concurrency();
+  return (threads > 1UL) ? (threads - 1UL) : 1UL;
+}
+
+inline void WorkStealingPool::submit(const Task& task)
+{
+  Queue& queue = *queues_[index()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(task);
+  }
+
+  // NOTE: A worker counts itself as sleeping before it re-checks queued_, so one of the two
+  //       always observes the other
+  queued_.fetch_add(1);
+  if (sleeping_.load() > 0UL)
+  {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+  }
+}
+
+inline void WorkStealingPool::work(std::size_t self)
+{
+  current() = std::make_pair(this, self);
+
+  Task task;
+  int idle = 0;
+  while (!stopping_)
+  {
+    if (take(self, task))
+    {
+      task.run(task.context, task.index);
+      idle = 0;
+    }
+    else if (++idle < SpinCount)
+    {
+      std::this_thread::yield();
+    }
+    else
+    {
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleeping_.fetch_add(1);
+      wake_.wait(lock, [this]() { return queued_.load() > 0UL || stopping_; });
+      sleeping_.fetch_sub(1);
+      idle = 0;
+    }
+  }
+}
+
+inline bool WorkStealingPool::take(std::size_t self, Task& task)
+{
+  if (queued_.load() == 0UL)
+  {
+    return false;
+  }
+
+  // Newest task from own deque
+  {
+    Queue& queue = *queues_[self];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+      queued_.fetch_sub(1);
+      return true;
+    }
+  }
+
+  // Oldest task from any other deque
+  for (std::size_t offset = 1; offset < queues_.size(); offset++)
+  {
+    Queue& queue = *queues_[(self + offset) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+      queued_.fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+inline std::size_t WorkStealingPool::index() const
+{
+  const auto& thread = current();
+  return (thread.first == this) ? thread.second : (queues_.size() - 1UL);
+}
+}  // namespace thread
+}  // namespace ffnn
@@ -0,0 +1,159 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+#ifndef FFNN_THREAD_WORK_STEALING_POOL_H
+#define FFNN_THREAD_WORK_STEALING_POOL_H
+
+// C++ Standard Library
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ffnn
+{
+namespace thread
+{
+/**
+ * @brief Fixed-size pool of worker threads with per-thread task deques
+ *
+ *        Each worker pushes and pops tasks at the back of its own deque, and steals from the
+ *        front of other deques when its own is empty. Tasks submitted from threads outside the
+ *        pool go to a shared deque, which workers steal from in the same way.
+ *
+ *        Tasks are plain function/context pairs, so submitting a task never allocates.
+ */
+class WorkStealingPool
+{
+public:
+  /**
+   * @brief Unit of work
+   */
+  struct Task
+  {
+    /// Task body; called as <code>run(context, index)</code>
+    void (*run)(void* context, std::size_t index);
+
+    /// Opaque task state
+    void* context;
+
+    /// Task argument
+    std::size_t index;
+  };
+
+  /**
+   * @brief Setup constructor
+   * @param workers  number of worker threads
+   */
+  explicit
+  WorkStealingPool(std::size_t workers = defaultWorkers());
+
+  /**
+   * @brief Stops and joins all workers
+   * @warning Tasks which have not started are discarded
+   */
+  ~WorkStealingPool();
+
+  /**
+   * @brief Returns one less than the number of hardware threads, since the thread which waits
+   *        on submitted work (see <code>runUntil</code>) also runs tasks
+   */
+  static std::size_t defaultWorkers();
+
+  /**
+   * @brief Returns number of worker threads
+   */
+  inline std::size_t size() const
+  {
+    return workers_.size();
+  }
+
+  /**
+   * @brief Schedules a task
+   * @param task  task to run on any pool thread, or on a thread waiting in <code>runUntil</code>
+   */
+  void submit(const Task& task);
+
+  /**
+   * @brief Runs pending tasks on the calling thread until a condition is met
+   * @param done  nullary predicate; must become true through tasks of this pool or other threads
+   * @note  Spins (yielding) while no task is available
+   */
+  template<typename Predicate>
+  void runUntil(const Predicate& done)
+  {
+    const std::size_t self = index();
+    Task task;
+    while (!done())
+    {
+      if (take(self, task))
+      {
+        task.run(task.context, task.index);
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  /// Task deque of one thread
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  /// Number of empty polls before an idle worker sleeps
+  static constexpr int SpinCount = 64;
+
+  /// Worker thread loop
+  void work(std::size_t self);
+
+  /// Pops a task from deque <code>self</code>, or steals one from another deque
+  bool take(std::size_t self, Task& task);
+
+  /// Returns deque index of the calling thread (shared deque for threads outside the pool)
+  std::size_t index() const;
+
+  /// Returns pool and deque index of the calling thread
+  static std::pair<const WorkStealingPool*, std::size_t>& current()
+  {
+    static thread_local std::pair<const WorkStealingPool*, std::size_t> current_(NULL, 0);
+    return current_;
+  }
+
+  /// Worker deques, followed by the shared deque
+  std::vector<std::unique_ptr<Queue>> queues_;
+
+  /// Worker threads
+  std::vector<std::thread> workers_;
+
+  /// Number of tasks in all deques
+  std::atomic<std::size_t> queued_;
+
+  /// Number of sleeping workers
+  std::atomic<std::size_t> sleeping_;
+
+  /// Set when workers should exit
+  std::atomic<bool> stopping_;
+
+  /// Guards sleep/wake of idle workers
+  std::mutex sleep_mutex_;
+
+  /// Wakes idle workers
+  std::condition_variable wake_;
+};
+}  // namespace thread
+}  // namespace ffnn
+
+/// FFNN (implementation)
+#include <ffnn/thread/impl/work_stealing_pool.hpp>
+#endif  // FFNN_THREAD_WORK_STEALING_POOL_H
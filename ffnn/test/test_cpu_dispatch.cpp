@@ -0,0 +1,250 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// GTest
+#include <gtest/gtest.h>
+
+// Eigen
+#include <Eigen/Sparse>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/cpu/dispatch.h>
+#include <ffnn/cpu/kernels.h>
+
+namespace
+{
+/// All instruction set levels with dedicated kernel builds
+const ffnn::cpu::ISA ALL_ISAS[] =
+{
+  ffnn::cpu::ISA::Generic,
+  ffnn::cpu::ISA::SSE42,
+  ffnn::cpu::ISA::AVX2,
+  ffnn::cpu::ISA::AVX512
+};
+}  // namespace
+
+/***********************************************************/
+// Forces each supported kernel build and compares against
+// reference Eigen expressions
+//
+// Tests:
+//    - cpu::select
+//    - cpu::affine
+//    - cpu::transposeProduct
+//    - cpu::rankUpdate
+//    - cpu::gatherAffine
+//    - cpu::scatterRankUpdate
+//    - cpu::axpy
+/***********************************************************/
+TEST(TestCpuDispatch, KernelsMatchReference)
+{
+  // Odd sizes exercise vector remainders
+  static const int ROWS = 37;
+  static const int COLS = 23;
+
+  const Eigen::MatrixXf w = Eigen::MatrixXf::Random(ROWS, COLS);
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(COLS);
+  const Eigen::VectorXf b = Eigen::VectorXf::Random(ROWS);
+  const Eigen::VectorXf e = Eigen::VectorXf::Random(ROWS);
+
+  const ffnn::cpu::ISA initial = ffnn::cpu::active();
+  EXPECT_TRUE(ffnn::cpu::isSupported(initial));
+  EXPECT_TRUE(ffnn::cpu::isSupported(ffnn::cpu::ISA::Generic));
+
+  for (const auto& isa : ALL_ISAS)
+  {
+    if (!ffnn::cpu::isSupported(isa))
+    {
+      EXPECT_FALSE(ffnn::cpu::select(isa));
+      continue;
+    }
+    ASSERT_TRUE(ffnn::cpu::select(isa));
+    EXPECT_EQ(ffnn::cpu::active(), isa);
+    SCOPED_TRACE(ffnn::cpu::name(isa));
+
+    Eigen::VectorXf y(ROWS);
+    ffnn::cpu::affine(w, x, b, y);
+    EXPECT_TRUE(y.isApprox(w * x + b, 1e-5f));
+
+    Eigen::VectorXf z(COLS);
+    ffnn::cpu::transposeProduct(w, e, z);
+    EXPECT_TRUE(z.isApprox(w.transpose() * e, 1e-5f));
+
+    Eigen::MatrixXf a = w;
+    ffnn::cpu::rankUpdate(a, e, x);
+    EXPECT_TRUE(a.isApprox(w + e * x.transpose(), 1e-5f));
+
+    // Gathered columns, with a remainder after groups of four
+    Eigen::VectorXf xs = Eigen::VectorXf::Zero(COLS);
+    const int indices[] = {0, 3, 4, 9, 15, 22};
+    const int nnz = sizeof(indices) / sizeof(int);
+    for (int k = 0; k < nnz; k++)
+    {
+      xs(indices[k]) = x(indices[k]);
+    }
+    ffnn::cpu::gatherAffine(w, indices, nnz, xs, b, y);
+    EXPECT_TRUE(y.isApprox(w * xs + b, 1e-5f));
+
+    Eigen::VectorXf values(nnz);
+    for (int k = 0; k < nnz; k++)
+    {
+      values(k) = xs(indices[k]);
+    }
+    Eigen::MatrixXf s = w;
+    ffnn::cpu::scatterRankUpdate(s, e, indices, values.data(), nnz);
+    EXPECT_TRUE(s.isApprox(w + e * xs.transpose(), 1e-5f));
+
+    Eigen::MatrixXf c = w;
+    ffnn::cpu::axpy(-0.5f, a, c);
+    EXPECT_TRUE(c.isApprox(w - 0.5f * a, 1e-5f));
+  }
+
+  // Restore detected selection
+  EXPECT_TRUE(ffnn::cpu::select(initial));
+}
+
+/***********************************************************/
+// Forces each supported kernel build on aligned buffers,
+// whose columns fill whole aligned blocks, and compares
+// against reference Eigen expressions
+//
+// Tests:
+//    - cpu::affine
+//    - cpu::transposeProduct
+//    - cpu::rankUpdate
+//    - cpu::axpy
+/***********************************************************/
+TEST(TestCpuDispatch, AlignedKernelsMatchReference)
+{
+  static const int ROWS = 64;
+  static const int COLS = 23;
+
+  typedef ffnn::aligned::Map<Eigen::MatrixXf> MatrixMap;
+  typedef ffnn::aligned::Map<Eigen::VectorXf> VectorMap;
+
+  ffnn::aligned::Buffer<float> w_buffer(ROWS * COLS), a_buffer(ROWS * COLS);
+  ffnn::aligned::Buffer<float> b_buffer(ROWS), e_buffer(ROWS), y_buffer(ROWS), z_buffer(COLS);
+  MatrixMap w, a;
+  VectorMap b, e, y, z;
+  w.remap(w_buffer.data(), ROWS, COLS);
+  a.remap(a_buffer.data(), ROWS, COLS);
+  b.remap(b_buffer.data(), ROWS);
+  e.remap(e_buffer.data(), ROWS);
+  y.remap(y_buffer.data(), ROWS);
+  z.remap(z_buffer.data(), COLS);
+
+  w.setRandom();
+  b.setRandom();
+  e.setRandom();
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(COLS);
+
+  const ffnn::cpu::ISA initial = ffnn::cpu::active();
+  for (const auto& isa : ALL_ISAS)
+  {
+    if (!ffnn::cpu::select(isa))
+    {
+      continue;
+    }
+    SCOPED_TRACE(ffnn::cpu::name(isa));
+
+    ffnn::cpu::affine(w, x, b, y);
+    EXPECT_TRUE(y.isApprox(w * x + b, 1e-5f));
+
+    ffnn::cpu::transposeProduct(w, e, z);
+    EXPECT_TRUE(z.isApprox(w.transpose() * e, 1e-5f));
+
+    a = w;
+    ffnn::cpu::rankUpdate(a, e, x);
+    EXPECT_TRUE(a.isApprox(w + e * x.transpose(), 1e-5f));
+
+    ffnn::cpu::axpy(-0.5f, w, a);
+    EXPECT_TRUE(a.isApprox(0.5f * w + e * x.transpose(), 1e-5f));
+  }
+
+  // Restore detected selection
+  EXPECT_TRUE(ffnn::cpu::select(initial));
+}
+
+/***********************************************************/
+// Forces each supported kernel build and compares batched
+// kernels over strided samples against reference Eigen
+// expressions
+//
+// Tests:
+//    - cpu::batchAffine
+//    - cpu::sparseBatchAffine
+/***********************************************************/
+TEST(TestCpuDispatch, BatchKernelsMatchReference)
+{
+  // Odd sizes exercise row-tile and sample-tile remainders
+  static const int ROWS = 37;
+  static const int COLS = 23;
+  static const int COUNT = 7;
+  static const int STRIDE = 41;
+
+  typedef Eigen::Map<Eigen::MatrixXf, Eigen::Unaligned, Eigen::OuterStride<>> BatchMap;
+
+  const Eigen::MatrixXf w = Eigen::MatrixXf::Random(ROWS, COLS);
+  const Eigen::VectorXf b = Eigen::VectorXf::Random(ROWS);
+  Eigen::MatrixXf x_storage = Eigen::MatrixXf::Random(STRIDE, COUNT);
+  const BatchMap x(x_storage.data(), COLS, COUNT, Eigen::OuterStride<>(STRIDE));
+
+  const Eigen::SparseMatrix<float> sparse = w.sparseView(0.5f, 1.0f);
+  ASSERT_GT(sparse.nonZeros(), 0);
+  ASSERT_LT(sparse.nonZeros(), ROWS * COLS);
+
+  const ffnn::cpu::ISA initial = ffnn::cpu::active();
+  for (const auto& isa : ALL_ISAS)
+  {
+    if (!ffnn::cpu::select(isa))
+    {
+      continue;
+    }
+    SCOPED_TRACE(ffnn::cpu::name(isa));
+
+    Eigen::MatrixXf y_storage = Eigen::MatrixXf::Zero(STRIDE, COUNT);
+    BatchMap y(y_storage.data(), ROWS, COUNT, Eigen::OuterStride<>(STRIDE));
+
+    ffnn::cpu::batchAffine(w, x, b, y);
+    EXPECT_TRUE(y.isApprox((w * x).colwise() + b, 1e-5f));
+
+    ffnn::cpu::sparseBatchAffine(sparse, x, b, y);
+    EXPECT_TRUE(y.isApprox((Eigen::MatrixXf(sparse) * x).colwise() + b, 1e-5f));
+
+    // Padding between samples is untouched
+    EXPECT_TRUE(y_storage.bottomRows(STRIDE - ROWS).isZero());
+  }
+
+  // Restore detected selection
+  EXPECT_TRUE(ffnn::cpu::select(initial));
+}
+
+/***********************************************************/
+// Checks double-precision kernels on the detected build
+//
+// Tests:
+//    - cpu::affine
+//    - cpu::transposeProduct
+/***********************************************************/
+TEST(TestCpuDispatch, DoublePrecision)
+{
+  const Eigen::MatrixXd w = Eigen::MatrixXd::Random(9, 5);
+  const Eigen::VectorXd x = Eigen::VectorXd::Random(5);
+  const Eigen::VectorXd b = Eigen::VectorXd::Random(9);
+
+  Eigen::VectorXd y(9);
+  ffnn::cpu::affine(w, x, b, y);
+  EXPECT_TRUE(y.isApprox(w * x + b, 1e-12));
+
+  Eigen::VectorXd z(5);
+  ffnn::cpu::transposeProduct(w, y, z);
+  EXPECT_TRUE(z.isApprox(w.transpose() * y, 1e-12));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
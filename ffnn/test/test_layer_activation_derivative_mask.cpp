@@ -0,0 +1,135 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/distribution/standard_normal.h>
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/neuron/leaky_rectified_linear.h>
+#include <ffnn/neuron/modifier/dropout.h>
+#include <ffnn/neuron/modifier/inverted_dropout.h>
+#include <ffnn/neuron/rectified_linear.h>
+#include <ffnn/neuron/sigmoid.h>
+
+/// Leaky-rectified linear neuron with a leak factor of 0.1
+template<typename ValueType>
+using LeakyRectifiedLinear = ffnn::neuron::LeakyRectifiedLinear<ValueType, 10>;
+
+/// Rectified linear neuron with 25% inverted dropout
+template<typename ValueType>
+using RectifiedLinearInvertedDropout =
+  ffnn::neuron::modifier::InvertedDropout<ValueType, ffnn::neuron::RectifiedLinear, 25>;
+
+/// Rectified linear neuron with 25% (per-neuron) dropout
+template<typename ValueType>
+using RectifiedLinearDropout =
+  ffnn::neuron::modifier::Dropout<ValueType, ffnn::neuron::RectifiedLinear, ffnn::distribution::StandardNormal, 25>;
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Output = ffnn::layer::Output<float>;
+
+/**
+ * @brief Back-propagates error through an activation layer, after its inputs have been overwritten
+ * @param x  inputs of the forward pass
+ * @param[out] error  error at the outputs of the activation layer
+ * @return error back-propagated by the activation layer
+ */
+template<template<class> class NeuronType>
+Eigen::VectorXf backward(const Eigen::VectorXf& x, Eigen::VectorXf& error)
+{
+  auto input = boost::make_shared<Input>(x.size());
+  auto activation = boost::make_shared<ffnn::layer::Activation<float, NeuronType>>();
+  auto output = boost::make_shared<Output>();
+  activation->setInputErrorEnabled(true);
+
+  const std::vector<Layer::Ptr> layers({input, activation, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  (*input) << x;
+  EXPECT_TRUE(activation->forward());
+  (*output) << Eigen::VectorXf::Zero(x.size()).eval();
+  error = Eigen::Map<const Eigen::VectorXf>(output->getBackwardErrorBuffer().data(), x.size());
+
+  // Derivatives are not recomputed from inputs
+  (*input) << (-x).eval();
+  EXPECT_TRUE(activation->backward());
+  return Eigen::Map<const Eigen::VectorXf>(activation->getBackwardErrorBuffer().data(), x.size());
+}
+
+/***********************************************************/
+// Only exact neuron types with a binary derivative keep
+// derivative bits
+//
+// Tests:
+//    - neuron::HasBinaryDerivative
+/***********************************************************/
+TEST(TestLayerActivationDerivativeMask, Traits)
+{
+  EXPECT_TRUE((ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>::HasDerivativeMask));
+  EXPECT_TRUE((ffnn::layer::Activation<float, LeakyRectifiedLinear>::HasDerivativeMask));
+  EXPECT_TRUE((ffnn::layer::Activation<float, RectifiedLinearInvertedDropout>::HasDerivativeMask));
+  EXPECT_FALSE((ffnn::layer::Activation<float, RectifiedLinearDropout>::HasDerivativeMask));
+  EXPECT_FALSE((ffnn::layer::Activation<float, ffnn::neuron::Sigmoid>::HasDerivativeMask));
+}
+
+/***********************************************************/
+// Back-propagated error matches neuron derivatives at the
+// inputs of the forward pass
+//
+// Tests:
+//    - layer::Activation::backward (derivative masks)
+/***********************************************************/
+TEST(TestLayerActivationDerivativeMask, MatchesDerivative)
+{
+  // Spans several mask words, and a partial word
+  static const int SIZE = 203;
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(SIZE);
+
+  // Rectified linear
+  {
+    Eigen::VectorXf error;
+    const Eigen::VectorXf back = backward<ffnn::neuron::RectifiedLinear>(x, error);
+    for (int idx = 0; idx < SIZE; idx++)
+    {
+      EXPECT_EQ(back(idx), (x(idx) > 0) ? error(idx) : 0.0f);
+    }
+  }
+
+  // Leaky-rectified linear
+  {
+    Eigen::VectorXf error;
+    const Eigen::VectorXf back = backward<LeakyRectifiedLinear>(x, error);
+    for (int idx = 0; idx < SIZE; idx++)
+    {
+      EXPECT_FLOAT_EQ(back(idx), (x(idx) > 0) ? error(idx) : 0.1f * error(idx));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
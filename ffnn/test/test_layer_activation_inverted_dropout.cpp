@@ -0,0 +1,285 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <cmath>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/memory/arena_resource.h>
+#include <ffnn/memory/resource.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/neuron/linear.h>
+#include <ffnn/neuron/modifier/inverted_dropout.h>
+#include <ffnn/neuron/rectified_linear.h>
+
+/// Rectified linear neuron with 25% inverted dropout
+template<typename ValueType>
+using RectifiedLinearDropout =
+  ffnn::neuron::modifier::InvertedDropout<ValueType, ffnn::neuron::RectifiedLinear, 25>;
+
+/// Linear neuron with 25% inverted dropout
+template<typename ValueType>
+using LinearDropout =
+  ffnn::neuron::modifier::InvertedDropout<ValueType, ffnn::neuron::Linear, 25>;
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, RectifiedLinearDropout>;
+using Output = ffnn::layer::Output<float>;
+using Plan = ffnn::network::InferencePlan<float>;
+
+/***********************************************************/
+// Checks dropout rate, survivor scaling and error masking in
+// training mode, and plain activations in evaluation mode
+//
+// Tests:
+//    - neuron::modifier::InvertedDropout
+//    - layer::Activation::setTraining
+/***********************************************************/
+TEST(TestLayerActivationInvertedDropout, TrainingAndEvaluation)
+{
+  static const int SIZE = 4096;
+  static const float SCALE = 4.0f / 3.0f;
+
+  EXPECT_TRUE(Activation::HasDropout);
+  EXPECT_FALSE((ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>::HasDropout));
+
+  auto input = boost::make_shared<Input>(SIZE);
+  auto activation = boost::make_shared<Activation>();
+  auto output = boost::make_shared<Output>();
+  activation->setInputErrorEnabled(true);
+
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, activation));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(activation, output));
+
+  std::vector<Layer::Ptr> layers({input, activation, output});
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Positive inputs pass through the rectifier
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(SIZE).cwiseAbs().array() + 0.5f;
+  const Eigen::VectorXf t = Eigen::VectorXf::Random(SIZE);
+  Eigen::VectorXf y(SIZE), y_prev(SIZE);
+
+  // Training mode
+  ASSERT_TRUE(activation->isTraining());
+  for (int pass = 0; pass < 2; pass++)
+  {
+    (*input) << x;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> y;
+
+    // Outputs are dropped at the expected rate, and survivors are scaled up
+    int dropped = 0;
+    for (int idx = 0; idx < SIZE; idx++)
+    {
+      if (y(idx) == 0.0f)
+      {
+        dropped++;
+      }
+      else
+      {
+        EXPECT_NEAR(y(idx), SCALE * x(idx), 1e-5f);
+      }
+    }
+    EXPECT_NEAR(static_cast<float>(dropped) / SIZE, 0.25f, 0.03f);
+    EXPECT_NEAR((y.array() / x.array()).mean(), 1.0f, 0.05f);
+
+    // Each pass draws a new mask
+    if (pass > 0)
+    {
+      EXPECT_FALSE(y.isApprox(y_prev));
+    }
+    y_prev = y;
+
+    // Error is masked (and scaled) like outputs
+    (*output) << t;
+    const Eigen::VectorXf e = Eigen::Map<const Eigen::VectorXf>(output->getBackwardErrorBuffer().data(), SIZE);
+    for (auto itr = layers.rbegin(); itr != layers.rend(); ++itr)
+    {
+      EXPECT_TRUE((*itr)->backward());
+    }
+    const Eigen::VectorXf g = Eigen::Map<const Eigen::VectorXf>(activation->getBackwardErrorBuffer().data(), SIZE);
+    const Eigen::VectorXf expected = (y.array() != 0.0f).select(SCALE * e, Eigen::VectorXf::Zero(SIZE));
+    EXPECT_TRUE(g.isApprox(expected, 1e-5f));
+  }
+
+  // Evaluation mode
+  activation->setTraining(false);
+  (*input) << x;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  (*output) >> y;
+  EXPECT_TRUE(y.isApprox(x));
+
+  (*output) << t;
+  const Eigen::VectorXf e = Eigen::Map<const Eigen::VectorXf>(output->getBackwardErrorBuffer().data(), SIZE);
+  for (auto itr = layers.rbegin(); itr != layers.rend(); ++itr)
+  {
+    EXPECT_TRUE((*itr)->backward());
+  }
+  const Eigen::VectorXf g = Eigen::Map<const Eigen::VectorXf>(activation->getBackwardErrorBuffer().data(), SIZE);
+  EXPECT_TRUE(g.isApprox(e));
+
+  // Stateless forward propagation never drops outputs
+  Eigen::VectorXf r(SIZE);
+  EXPECT_TRUE(activation->infer(x.data(), SIZE, r.data(), SIZE, 1));
+  EXPECT_TRUE(r.isApprox(x));
+}
+
+/***********************************************************/
+// Batched Monte Carlo dropout through a linear network, for
+// which output mean and variance are known
+//
+// Tests:
+//    - network::InferencePlan::sample
+//    - layer::Activation::sample
+/***********************************************************/
+TEST(TestLayerActivationInvertedDropout, MonteCarlo)
+{
+  static const int SAMPLES = 4000;
+  static const int IN = 16, HIDDEN = 64, OUT = 4;
+
+  auto input = boost::make_shared<Input>(IN);
+  auto hidden1 = boost::make_shared<Hidden>(HIDDEN);
+  auto dropout = boost::make_shared<ffnn::layer::Activation<float, LinearDropout>>();
+  auto hidden2 = boost::make_shared<Hidden>(OUT);
+  auto output = boost::make_shared<Output>();
+
+  std::vector<Layer::Ptr> layers({input, hidden1, dropout, hidden2, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  Plan::Workspace workspace = plan.createWorkspace(SAMPLES);
+
+  // Without dropout
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(IN);
+  Eigen::VectorXf y(OUT);
+  EXPECT_TRUE(plan.forward(x, y, workspace));
+
+  // Each mask value has unit mean and variance p/(1-p)
+  const Eigen::VectorXf h = hidden1->getWeights() * x + hidden1->getBiases();
+  const Eigen::VectorXf expected_variance =
+    (hidden2->getWeights().array().square().matrix() * h.array().square().matrix()) / 3.0f;
+
+  Eigen::VectorXf mean(OUT), variance(OUT);
+  EXPECT_TRUE(plan.sample(x, SAMPLES, mean, variance, workspace, 0));
+  const float stddev = std::sqrt(expected_variance.maxCoeff() / SAMPLES);
+  for (int idx = 0; idx < OUT; idx++)
+  {
+    EXPECT_NEAR(mean(idx), y(idx), 5 * stddev);
+    EXPECT_NEAR(variance(idx), expected_variance(idx), 0.1f * expected_variance(idx));
+  }
+
+  // Same as a replicated batch with the same pass identifier
+  const Eigen::MatrixXf batch = x.replicate(1, SAMPLES);
+  Eigen::MatrixXf results(OUT, SAMPLES);
+  const float* inputs[1] = {batch.data()};
+  float* outputs[1] = {results.data()};
+  EXPECT_TRUE(plan.sample(inputs, outputs, SAMPLES, workspace, 0));
+  EXPECT_TRUE(results.rowwise().mean().isApprox(mean, 1e-5f));
+  EXPECT_FALSE(results.col(0).isApprox(results.col(1)));
+
+  // Distinct pass identifiers draw distinct masks
+  Eigen::VectorXf other_mean(OUT), other_variance(OUT);
+  EXPECT_TRUE(plan.sample(x, SAMPLES, other_mean, other_variance, workspace, 1));
+  EXPECT_FALSE(other_mean.isApprox(mean, 1e-6f));
+}
+
+/***********************************************************/
+// Checks that a dropout mask allocated from a scoped
+// resource is released correctly once the scope has ended
+//
+// Tests:
+//    - layer::Activation::setTraining
+//    - memory::ScopedResource
+/***********************************************************/
+TEST(TestLayerActivationInvertedDropout, ReleaseMaskOutsideScope)
+{
+  static const int SIZE = 256;
+
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(SIZE).cwiseAbs().array() + 0.5f;
+  Eigen::VectorXf y(SIZE);
+
+  ffnn::memory::ArenaResource arena;
+  boost::shared_ptr<Input> input;
+  boost::shared_ptr<Activation> activation;
+  boost::shared_ptr<Output> output;
+  std::vector<Layer::Ptr> layers;
+  {
+    ffnn::memory::ScopedResource scope(&arena);
+    input = boost::make_shared<Input>(SIZE);
+    activation = boost::make_shared<Activation>();
+    output = boost::make_shared<Output>();
+    layers = {input, activation, output};
+
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(input, activation));
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(activation, output));
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->initialize());
+    }
+
+    // Training pass allocates the mask from the arena
+    (*input) << x;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    EXPECT_TRUE(arena.owns(output->getInputBuffer().data()));
+  }
+
+  // Mask is returned to the arena, not the default resource
+  activation->setTraining(false);
+  (*input) << x;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  (*output) >> y;
+  EXPECT_TRUE(y.isApprox(x));
+
+  // Training again reallocates the mask
+  activation->setTraining(true);
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
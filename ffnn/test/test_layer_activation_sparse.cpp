@@ -0,0 +1,200 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/neuron/rectified_linear.h>
+#include <ffnn/neuron/sigmoid.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::RectifiedLinear>;
+using Output = ffnn::layer::Output<float>;
+
+/// A network with a rectified hidden layer
+struct Network
+{
+  boost::shared_ptr<Input> input;
+  boost::shared_ptr<Hidden> hidden1;
+  boost::shared_ptr<Activation> activation;
+  boost::shared_ptr<Hidden> hidden2;
+  boost::shared_ptr<Output> output;
+  std::vector<Layer::Ptr> layers;
+
+  Network(int inputs, int units, int outputs) :
+    input(boost::make_shared<Input>(inputs)),
+    hidden1(boost::make_shared<Hidden>(units)),
+    activation(boost::make_shared<Activation>()),
+    hidden2(boost::make_shared<Hidden>(outputs)),
+    output(boost::make_shared<Output>()),
+    layers({input, hidden1, activation, hidden2, output})
+  {
+    hidden1->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(1e-2));
+    hidden2->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(1e-2));
+    for (size_t idx = 1UL; idx < layers.size(); idx++)
+    {
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+    }
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->initialize());
+    }
+  }
+
+  /// Runs a forward pass; returns network outputs
+  Eigen::VectorXf forward(const Eigen::VectorXf& x)
+  {
+    (*input) << x;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    Eigen::VectorXf y(output->inputSize());
+    (*output) >> y;
+    return y;
+  }
+
+  /// Runs one training step; returns network outputs
+  Eigen::VectorXf train(const Eigen::VectorXf& x, const Eigen::VectorXf& target)
+  {
+    const Eigen::VectorXf y = forward(x);
+    (*output) << target;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->backward());
+    }
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->update());
+    }
+    return y;
+  }
+};
+
+/***********************************************************/
+// Training over compacted rectified outputs matches training
+// over dense outputs
+//
+// Tests:
+//    - layer::Activation (sparse outputs)
+//    - layer::FullyConnected (sparse inputs)
+//    - optimizer::GradientDescent[FullyConnected] (sparse inputs)
+/***********************************************************/
+TEST(TestLayerActivationSparse, MatchesDense)
+{
+  static const int INPUTS = 16;
+  static const int UNITS = 64;
+  static const int OUTPUTS = 8;
+
+  EXPECT_TRUE(Activation::HasSparseOutputs);
+  EXPECT_FALSE((ffnn::layer::Activation<float, ffnn::neuron::Sigmoid>::HasSparseOutputs));
+
+  Network sparse(INPUTS, UNITS, OUTPUTS);
+  Network dense(INPUTS, UNITS, OUTPUTS);
+  dense.activation->setSparseOutputs(0.0);
+
+  // Only every fourth unit is biased to be active
+  Eigen::VectorXf biases(UNITS);
+  for (int idx = 0; idx < UNITS; idx++)
+  {
+    biases(idx) = (idx % 4) ? -1.0f : 1.0f;
+  }
+  const Eigen::MatrixXf w1 = 0.1f * Eigen::MatrixXf::Random(UNITS, INPUTS);
+  const Eigen::MatrixXf w2 = Eigen::MatrixXf::Random(OUTPUTS, UNITS);
+  ASSERT_TRUE(sparse.hidden1->setParameters(w1, biases));
+  ASSERT_TRUE(dense.hidden1->setParameters(w1, biases));
+  ASSERT_TRUE(sparse.hidden2->setParameters(w2, Eigen::VectorXf::Zero(OUTPUTS)));
+  ASSERT_TRUE(dense.hidden2->setParameters(w2, Eigen::VectorXf::Zero(OUTPUTS)));
+
+  const Eigen::VectorXf target = Eigen::VectorXf::Ones(OUTPUTS);
+  for (int step = 0; step < 20; step++)
+  {
+    const Eigen::VectorXf x = Eigen::VectorXf::Random(INPUTS);
+    EXPECT_TRUE(sparse.train(x, target).isApprox(dense.train(x, target), 1e-5f));
+
+    // Outputs of the sparse network are compacted, and skipped by the next layer
+    EXPECT_EQ(sparse.activation->activeOutputCount(), UNITS / 4);
+    EXPECT_TRUE(sparse.hidden2->hasActiveInputs());
+    EXPECT_EQ(dense.activation->activeOutputCount(), -1);
+    EXPECT_FALSE(dense.hidden2->hasActiveInputs());
+  }
+
+  // Weights of inactive units are left untouched
+  EXPECT_TRUE(sparse.hidden2->getWeights().isApprox(dense.hidden2->getWeights(), 1e-5f));
+  EXPECT_TRUE(sparse.hidden1->getWeights().isApprox(dense.hidden1->getWeights(), 1e-5f));
+  EXPECT_TRUE(sparse.hidden2->getWeights().col(1) == w2.col(1));
+}
+
+/***********************************************************/
+// Outputs are only compacted when they are sparse enough
+//
+// Tests:
+//    - layer::Activation::setSparseOutputs
+/***********************************************************/
+TEST(TestLayerActivationSparse, AdaptiveDensity)
+{
+  static const int INPUTS = 4;
+  static const int UNITS = 32;
+
+  Network network(INPUTS, UNITS, 2);
+  const Eigen::MatrixXf w1 = Eigen::MatrixXf::Zero(UNITS, INPUTS);
+  const Eigen::MatrixXf w2 = Eigen::MatrixXf::Random(2, UNITS);
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(INPUTS);
+  ASSERT_TRUE(network.hidden2->setParameters(w2, Eigen::VectorXf::Zero(2)));
+
+  // All units active: dense
+  ASSERT_TRUE(network.hidden1->setParameters(w1, Eigen::VectorXf::Ones(UNITS)));
+  EXPECT_TRUE(network.forward(x).isApprox(w2 * Eigen::VectorXf::Ones(UNITS)));
+  EXPECT_EQ(network.activation->activeOutputCount(), -1);
+  EXPECT_FALSE(network.hidden2->hasActiveInputs());
+
+  // No units active: sparse
+  ASSERT_TRUE(network.hidden1->setParameters(w1, -Eigen::VectorXf::Ones(UNITS)));
+  EXPECT_TRUE(network.forward(x).isZero());
+  EXPECT_EQ(network.activation->activeOutputCount(), 0);
+  EXPECT_TRUE(network.hidden2->hasActiveInputs());
+
+  // Half of all units active: sparse only below a higher density
+  Eigen::VectorXf biases(UNITS);
+  for (int idx = 0; idx < UNITS; idx++)
+  {
+    biases(idx) = (idx < UNITS / 2) ? 1.0f : -1.0f;
+  }
+  ASSERT_TRUE(network.hidden1->setParameters(w1, biases));
+  network.activation->setSparseOutputs(0.25);
+  network.forward(x);
+  EXPECT_EQ(network.activation->activeOutputCount(), -1);
+  network.activation->setSparseOutputs(0.75);
+  const Eigen::VectorXf y = network.forward(x);
+  EXPECT_EQ(network.activation->activeOutputCount(), UNITS / 2);
+  EXPECT_EQ(network.hidden2->activeInputCount(), UNITS / 2);
+  EXPECT_TRUE(y.isApprox(w2.leftCols(UNITS / 2) * Eigen::VectorXf::Ones(UNITS / 2)));
+
+  // Disabling compaction marks inputs of the next layer as dense
+  network.activation->setSparseOutputs(0.0);
+  EXPECT_FALSE(network.hidden2->hasActiveInputs());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,308 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <fstream>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/embedding.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/io.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// NOTE: Only the Adam[Embedding] specialization is included; <ffnn/optimizer/adam.h> also pulls in
+//       the Adam[FullyConnected] and Adam[SparselyConnected] specializations
+#include <ffnn/optimizer/impl/adam/embedding.hpp>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Embedding = ffnn::layer::Embedding<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Output = ffnn::layer::Output<float>;
+
+/// Connects layers in a chain, and initializes them
+void createChain(const std::vector<Layer::Ptr>& layers)
+{
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+}
+
+/// Runs one training step; returns the error back-propagated into the last hidden layer
+Eigen::VectorXf train(const std::vector<Layer::Ptr>& layers,
+                      Input& input,
+                      Output& output,
+                      const Eigen::VectorXf& x,
+                      const Eigen::VectorXf& target)
+{
+  input << x;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  output << target;
+  const Eigen::VectorXf error =
+    Eigen::Map<const Eigen::VectorXf>(output.getBackwardErrorBuffer().data(), output.inputSize());
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->backward());
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->update());
+  }
+  return error;
+}
+
+/***********************************************************/
+// Looks up embeddings of several ids per pass
+//
+// Tests:
+//    - layer::Embedding::forward
+//    - layer::Embedding::infer
+/***********************************************************/
+TEST(TestLayerEmbedding, Lookup)
+{
+  static const int VOCABULARY = 1000;
+  static const int DIM = 6;
+
+  auto input = boost::make_shared<Input>(3);
+  auto embedding = boost::make_shared<Embedding>(VOCABULARY, DIM, 3);
+  auto output = boost::make_shared<Output>();
+  createChain({input, embedding, output});
+  ASSERT_EQ(embedding->outputSize(), 3 * DIM);
+
+  const auto& table = embedding->getTable();
+  ASSERT_EQ(table.rows(), DIM);
+  ASSERT_EQ(table.cols(), VOCABULARY);
+
+  Eigen::VectorXf ids(3);
+  ids << 7, 999, 7;
+  (*input) << ids;
+  EXPECT_TRUE(embedding->forward());
+
+  Eigen::VectorXf y(3 * DIM);
+  (*output) >> y;
+  EXPECT_TRUE(y.segment(0, DIM) == table.col(7));
+  EXPECT_TRUE(y.segment(DIM, DIM) == table.col(999));
+  EXPECT_TRUE(y.segment(2 * DIM, DIM) == table.col(7));
+
+  // Batched lookup
+  Eigen::MatrixXf batch_ids(3, 2);
+  batch_ids << 0, 5,
+               1, 6,
+               2, 7;
+  Eigen::MatrixXf batch_y(3 * DIM, 2);
+  EXPECT_TRUE(embedding->infer(batch_ids.data(), 3, batch_y.data(), 3 * DIM, 2));
+  EXPECT_TRUE(batch_y.col(1).segment(DIM, DIM) == table.col(6));
+  EXPECT_TRUE(batch_y.col(0).segment(2 * DIM, DIM) == table.col(2));
+
+  // Ids which are out of range, or not integers, are rejected
+  ids << 7, VOCABULARY, 7;
+  (*input) << ids;
+  EXPECT_FALSE(embedding->forward());
+  ids << 7, 1.5f, 7;
+  (*input) << ids;
+  EXPECT_FALSE(embedding->forward());
+}
+
+/***********************************************************/
+// Saves and reconstructs an embedding layer
+//
+// Tests:
+//    - Save
+//    - Load
+//    - layer::Embedding
+/***********************************************************/
+TEST(TestLayerEmbedding, SaveLoad)
+{
+  Eigen::MatrixXf table;
+  {
+    std::vector<Layer::Ptr> layers({boost::make_shared<Input>(2),
+                                    boost::make_shared<Embedding>(50, 4, 2),
+                                    boost::make_shared<Output>()});
+    createChain(layers);
+    table = static_cast<const Embedding&>(*layers[1]).getTable();
+
+    std::ofstream ofs("embedding_io_test.nnl", std::ios::binary);
+    for(const auto& layer : layers)
+    {
+      EXPECT_NO_THROW(ffnn::save(ofs, *layer));
+    }
+  }
+
+  auto embedding = boost::make_shared<Embedding>();
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(), embedding, boost::make_shared<Output>()});
+  {
+    std::ifstream ifs("embedding_io_test.nnl", std::ios::binary);
+    for(const auto& layer : layers)
+    {
+      EXPECT_NO_THROW(ffnn::load(ifs, *layer));
+    }
+  }
+  createChain(layers);
+  EXPECT_EQ(embedding->vocabularySize(), 50);
+  EXPECT_EQ(embedding->embeddingSize(), 4);
+  EXPECT_EQ(embedding->inputSize(), 2);
+  EXPECT_TRUE(embedding->getTable() == table);
+}
+
+/***********************************************************/
+// Embedding updates match those of a fully-connected layer
+// fed by a one-hot encoding
+//
+// Tests:
+//    - layer::Embedding
+//    - optimizer::GradientDescent[Embedding]
+/***********************************************************/
+TEST(TestLayerEmbedding, GradientDescentMatchesOneHot)
+{
+  static const int VOCABULARY = 40;
+  static const int DIM = 5;
+
+  auto input = boost::make_shared<Input>(1);
+  auto embedding = boost::make_shared<Embedding>(VOCABULARY, DIM);
+  auto output = boost::make_shared<Output>();
+  embedding->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Embedding>>(1e-1));
+  const std::vector<Layer::Ptr> layers({input, embedding, output});
+  createChain(layers);
+
+  auto one_hot_input = boost::make_shared<Input>(VOCABULARY);
+  auto hidden = boost::make_shared<Hidden>(DIM);
+  auto one_hot_output = boost::make_shared<Output>();
+  hidden->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(1e-1));
+  const std::vector<Layer::Ptr> one_hot_layers({one_hot_input, hidden, one_hot_output});
+  createChain(one_hot_layers);
+  ASSERT_TRUE(hidden->setParameters(embedding->getTable(), Eigen::VectorXf::Zero(DIM)));
+
+  const Eigen::MatrixXf initial = embedding->getTable();
+  const Eigen::VectorXf target = Eigen::VectorXf::Ones(DIM);
+  const int ids[] = {3, 17, 3};
+  for (const int id : ids)
+  {
+    Eigen::VectorXf x(1);
+    x << id;
+    train(layers, *input, *output, x, target);
+
+    // Biases of the fully-connected layer also change; reset them, so that outputs match
+    const Eigen::VectorXf one_hot = Eigen::VectorXf::Unit(VOCABULARY, id);
+    train(one_hot_layers, *one_hot_input, *one_hot_output, one_hot, target);
+    ASSERT_TRUE(hidden->setParameters(hidden->getWeights(), Eigen::VectorXf::Zero(DIM)));
+
+    EXPECT_TRUE(embedding->getTable().isApprox(hidden->getWeights(), 1e-6f));
+  }
+
+  // Only embeddings of seen ids change
+  for (int id = 0; id < VOCABULARY; id++)
+  {
+    EXPECT_EQ(embedding->getTable().col(id) == initial.col(id), id != 3 && id != 17);
+  }
+}
+
+/***********************************************************/
+// Repeated ids accumulate one gradient; lazy Adam moves only
+// embeddings of ids seen since the last update
+//
+// Tests:
+//    - optimizer::GradientDescent[Embedding] (repeated ids)
+//    - optimizer::Adam[Embedding]
+/***********************************************************/
+TEST(TestLayerEmbedding, SparseUpdates)
+{
+  static const int VOCABULARY = 100000;
+  static const int DIM = 8;
+  static const float LR = 1e-2f;
+
+  // Gradient descent
+  {
+    auto input = boost::make_shared<Input>(3);
+    auto embedding = boost::make_shared<Embedding>(VOCABULARY, DIM, 3);
+    auto output = boost::make_shared<Output>();
+    auto optimizer = boost::make_shared<ffnn::optimizer::GradientDescent<Embedding>>(LR);
+    embedding->setOptimizer(optimizer);
+    const std::vector<Layer::Ptr> layers({input, embedding, output});
+    createChain(layers);
+
+    const Eigen::MatrixXf initial = embedding->getTable();
+    Eigen::VectorXf ids(3);
+    ids << 4, 99999, 4;
+
+    (*input) << ids;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) << Eigen::VectorXf::Zero(3 * DIM).eval();
+    const Eigen::VectorXf error =
+      Eigen::Map<const Eigen::VectorXf>(output->getBackwardErrorBuffer().data(), 3 * DIM);
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->backward());
+    }
+    EXPECT_EQ(optimizer->getTouchedIds(), std::vector<Layer::SizeType>({4, 99999}));
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->update());
+    }
+    EXPECT_TRUE(optimizer->getTouchedIds().empty());
+
+    const Eigen::VectorXf expected = initial.col(4) - LR * (error.segment(0, DIM) + error.segment(2 * DIM, DIM));
+    EXPECT_TRUE(embedding->getTable().col(4).isApprox(expected, 1e-6f));
+    EXPECT_TRUE(embedding->getTable().col(99999).isApprox(initial.col(99999) - LR * error.segment(DIM, DIM), 1e-6f));
+    EXPECT_TRUE(embedding->getTable().col(5) == initial.col(5));
+  }
+
+  // Lazy Adam
+  {
+    auto input = boost::make_shared<Input>(1);
+    auto embedding = boost::make_shared<Embedding>(VOCABULARY, DIM);
+    auto output = boost::make_shared<Output>();
+    embedding->setOptimizer(boost::make_shared<ffnn::optimizer::Adam<Embedding>>(LR));
+    const std::vector<Layer::Ptr> layers({input, embedding, output});
+    createChain(layers);
+
+    const Eigen::MatrixXf initial = embedding->getTable();
+    const Eigen::VectorXf target = Eigen::VectorXf::Ones(DIM);
+
+    // First Adam step moves each value by (almost exactly) the learning rate
+    Eigen::VectorXf x(1);
+    x << 12;
+    train(layers, *input, *output, x, target);
+    EXPECT_TRUE((embedding->getTable().col(12) - initial.col(12)).cwiseAbs().isApprox(
+                 Eigen::VectorXf::Constant(DIM, LR), 1e-3f));
+
+    // Embeddings move towards the target while seen; others do not move
+    for (int step = 0; step < 50; step++)
+    {
+      x << ((step % 2) ? 12 : 20);
+      train(layers, *input, *output, x, target);
+    }
+    EXPECT_LT((embedding->getTable().col(12) - target).norm(), (initial.col(12) - target).norm());
+    EXPECT_LT((embedding->getTable().col(20) - target).norm(), (initial.col(20) - target).norm());
+    EXPECT_TRUE(embedding->getTable().col(13) == initial.col(13));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,248 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <string>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/activation_plan.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+
+// Network sizes
+static const int INPUTS = 6;
+static const int TRUNK = 10;
+static const int HEADS[3] = {3, 2, 4};
+
+/**
+ * @brief Creates a fully-connected layer with an optimizer
+ */
+boost::shared_ptr<Hidden> createHidden(int outputs, const std::string& id = std::string())
+{
+  auto layer = boost::make_shared<Hidden>(outputs);
+  layer->setOptimizer(boost::make_shared<Optimizer>(1e-2));
+  if (!id.empty())
+  {
+    layer->setID(id);
+  }
+  return layer;
+}
+
+/**
+ * @brief Runs one forward/backward pass and returns the network outputs
+ */
+std::vector<Eigen::VectorXf> run(const std::vector<Layer::Ptr>& layers,
+                                 const std::vector<boost::shared_ptr<Input>>& inputs,
+                                 const std::vector<boost::shared_ptr<Output>>& outputs,
+                                 const Eigen::VectorXf& input_data,
+                                 const std::vector<Eigen::VectorXf>& targets)
+{
+  for (const auto& input : inputs)
+  {
+    (*input) << input_data;
+  }
+  for (const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+
+  std::vector<Eigen::VectorXf> results;
+  for (std::size_t odx = 0; odx < outputs.size(); odx++)
+  {
+    results.push_back(Eigen::VectorXf(targets[odx].size()));
+    (*outputs[odx]) >> results.back();
+    (*outputs[odx]) << targets[odx];
+  }
+  for (auto itr = layers.rbegin(); itr != layers.rend(); ++itr)
+  {
+    EXPECT_TRUE((*itr)->backward());
+  }
+  return results;
+}
+
+/***********************************************************/
+// Compares a network whose trunk feeds several heads with
+// an equivalent network which replicates the trunk per head
+//
+// Tests:
+//    - layer::Hidden fan-out (shared views, copies)
+//    - layer::Input fan-out
+//    - Summation of back-propagated error over consumers
+//    - network::ActivationPlan with fan-out
+/***********************************************************/
+TEST(TestLayerFanOut, MultiHead)
+{
+  // Shared trunk, feeding three heads and a network output; the network input also
+  // feeds the last head, next to the trunk (concatenated)
+  auto input = boost::make_shared<Input>(INPUTS);
+  auto trunk = createHidden(TRUNK);
+  auto activation = boost::make_shared<Activation>();
+  input->setID("a_in");
+  activation->setID("a_act");
+  trunk->setInputErrorEnabled(true);
+
+  std::vector<boost::shared_ptr<Hidden>> heads;
+  std::vector<boost::shared_ptr<Output>> outputs(4);
+  for (int hdx = 0; hdx < 3; hdx++)
+  {
+    heads.push_back(createHidden(HEADS[hdx]));
+  }
+  for (auto& output : outputs)
+  {
+    output = boost::make_shared<Output>();
+  }
+
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, trunk));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(trunk, activation));
+  for (int hdx = 0; hdx < 3; hdx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(activation, heads[hdx]));
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(heads[hdx], outputs[hdx + 1]));
+  }
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, heads[2]));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(activation, outputs[0]));
+
+  std::vector<Layer::Ptr> layers({input, trunk, activation, heads[0], heads[1], heads[2],
+                                  outputs[0], outputs[1], outputs[2], outputs[3]});
+  for (const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // The first head holds trunk outputs; the second reads them in place; the concatenating
+  // head and the network output receive copies
+  ASSERT_EQ(activation->getNextLayers().size(), 4UL);
+  EXPECT_EQ(activation->getNextLayers()[0].layer, heads[0].get());
+  EXPECT_TRUE(activation->getNextLayers()[1].shared);
+  EXPECT_FALSE(activation->getNextLayers()[2].shared);
+  EXPECT_FALSE(activation->getNextLayers()[3].shared);
+  ASSERT_EQ(input->getNextLayers().size(), 2UL);
+  EXPECT_FALSE(input->getNextLayers()[1].shared);
+
+  // Replicated network: one trunk (with its own input) per consumer; parameters are shared
+  std::vector<Layer::Ptr> replicated;
+  std::vector<boost::shared_ptr<Input>> replicated_inputs;
+  std::vector<boost::shared_ptr<Output>> replicated_outputs;
+  std::vector<boost::shared_ptr<Hidden>> replicated_trunks;
+  std::vector<boost::shared_ptr<Hidden>> replicated_heads;
+  boost::shared_ptr<Input> replicated_concat_input;
+  for (int rdx = 0; rdx < 4; rdx++)
+  {
+    const std::string prefix = "b" + std::to_string(rdx);
+    auto replica_input = boost::make_shared<Input>(INPUTS);
+    auto replica_trunk = createHidden(TRUNK);
+    auto replica_activation = boost::make_shared<Activation>();
+    auto replica_output = boost::make_shared<Output>();
+    replica_activation->setID(prefix + "_act");
+    replica_trunk->setInputErrorEnabled(true);
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(replica_input, replica_trunk));
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(replica_trunk, replica_activation));
+    replicated.insert(replicated.end(), {replica_input, replica_trunk, replica_activation});
+
+    if (rdx == 0)
+    {
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(replica_activation, replica_output));
+    }
+    else
+    {
+      auto head = createHidden(HEADS[rdx - 1]);
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(replica_activation, head));
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(head, replica_output));
+      if (rdx == 3)
+      {
+        replicated_concat_input = boost::make_shared<Input>(INPUTS);
+        replicated_concat_input->setID(prefix + "_in");
+        EXPECT_TRUE(ffnn::layer::connect<Layer>(replicated_concat_input, head));
+        replicated.push_back(replicated_concat_input);
+        replicated_inputs.push_back(replicated_concat_input);
+      }
+      replicated.push_back(head);
+      replicated_heads.push_back(head);
+    }
+    replicated.push_back(replica_output);
+    replicated_inputs.push_back(replica_input);
+    replicated_outputs.push_back(replica_output);
+    replicated_trunks.push_back(replica_trunk);
+  }
+  for (const auto& layer : replicated)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+  for (int rdx = 0; rdx < 4; rdx++)
+  {
+    EXPECT_TRUE(replicated_trunks[rdx]->shareParameters(*trunk));
+  }
+  for (int hdx = 0; hdx < 3; hdx++)
+  {
+    EXPECT_TRUE(replicated_heads[hdx]->shareParameters(*heads[hdx]));
+  }
+
+  const Eigen::VectorXf input_data = Eigen::VectorXf::Random(INPUTS);
+  std::vector<Eigen::VectorXf> targets({Eigen::VectorXf::Random(TRUNK)});
+  for (int hdx = 0; hdx < 3; hdx++)
+  {
+    targets.push_back(Eigen::VectorXf::Random(HEADS[hdx]));
+  }
+
+  // Outputs match
+  const auto results = run(layers, {input}, outputs, input_data, targets);
+  const auto expected = run(replicated, replicated_inputs, replicated_outputs, input_data, targets);
+  for (std::size_t odx = 0; odx < results.size(); odx++)
+  {
+    EXPECT_TRUE(results[odx].isApprox(expected[odx], 1e-6f));
+  }
+
+  // Error w.r.t. the network input is the sum of errors over all consumers
+  const auto input_error = [](const Layer& next, int offset)
+  {
+    return Eigen::Map<const Eigen::VectorXf>(next.getBackwardErrorBuffer().data() + offset, INPUTS);
+  };
+  const auto& concat = input->getNextLayers()[1];
+  const Eigen::VectorXf error = input_error(*trunk, 0) + input_error(*concat.layer, concat.offset);
+
+  Eigen::VectorXf expected_error = Eigen::VectorXf::Zero(INPUTS);
+  for (const auto& replica_trunk : replicated_trunks)
+  {
+    expected_error += input_error(*replica_trunk, 0);
+  }
+  const auto& replicated_concat = replicated_concat_input->getNextLayers()[0];
+  expected_error += input_error(*replicated_concat.layer, replicated_concat.offset);
+  EXPECT_TRUE(error.isApprox(expected_error, 1e-5f));
+
+  // Planned activation memory keeps fanned-out outputs alive until their last consumer
+  ffnn::network::ActivationPlan<float> plan;
+  ASSERT_TRUE(plan.apply(layers));
+  const auto planned = run(layers, {input}, outputs, input_data, targets);
+  for (std::size_t odx = 0; odx < planned.size(); odx++)
+  {
+    EXPECT_TRUE(planned[odx].isApprox(expected[odx], 1e-6f));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
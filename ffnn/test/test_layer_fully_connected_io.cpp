@@ -5,6 +5,7 @@
 // C++ Standard Library
 #include <exception>
 #include <fstream>
+#include <string>
 #include <vector>
 
 // Boost
@@ -169,6 +170,111 @@ TEST(TestFullyConnectedLayerIO, LoadSignatureMismatch)
   ifs.close();
 }
 
+/// Fully-connected layer which writes weights in the unpadded input layout
+class UnpaddedFullyConnected :
+  public ffnn::layer::FullyConnected<float>
+{
+public:
+  explicit
+  UnpaddedFullyConnected(SizeType output_dim) :
+    ffnn::layer::FullyConnected<float>(output_dim)
+  {}
+
+  /// Overwrites weights with one column per unpadded input
+  void setUnpaddedWeights(const Eigen::MatrixXf& w)
+  {
+    weight_buffer_.assign(w.data(), w.data() + w.size());
+    w_.remap(weight_buffer_.data(), w.rows(), w.cols());
+    input_dimension_ = w.cols();
+  }
+};
+
+/***********************************************************/
+// Reconstructs a multi-input FullyConnected layer from data
+// saved before its input segments were padded
+//
+// Tests:
+//    - Load
+//    - layer::FullyConnected (unpadded weights)
+/***********************************************************/
+TEST(TestFullyConnectedLayerIO, LoadUnpaddedMultiInput)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Output = ffnn::layer::Output<float>;
+
+  // Input segment sizes which are not multiples of the alignment
+  static const int DIMS[2] = {3, 5};
+
+  // Save layers with weights in the unpadded layout
+  const Eigen::MatrixXf w = Eigen::MatrixXf::Random(4, DIMS[0] + DIMS[1]);
+  std::string ids[2];
+  {
+    auto input_a = boost::make_shared<Input>(DIMS[0]);
+    auto input_b = boost::make_shared<Input>(DIMS[1]);
+    auto hidden = boost::make_shared<UnpaddedFullyConnected>(4);
+    auto output = boost::make_shared<Output>();
+    std::vector<Layer::Ptr> layers({input_a, input_b, hidden, output});
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(input_a, hidden));
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(input_b, hidden));
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden, output));
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->initialize());
+    }
+    hidden->setUnpaddedWeights(w);
+    ids[0] = input_a->getID();
+    ids[1] = input_b->getID();
+
+    std::ofstream ofs("full_io_unpadded_test.nnl", std::ios::binary);
+    for(const auto& layer : layers)
+    {
+      EXPECT_NO_THROW(ffnn::save(ofs, *layer));
+    }
+  }
+
+  // Load and reconnect layers
+  auto input_a = boost::make_shared<Input>();
+  auto input_b = boost::make_shared<Input>();
+  auto hidden = boost::make_shared<Hidden>();
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input_a, input_b, hidden, output});
+  {
+    std::ifstream ifs("full_io_unpadded_test.nnl", std::ios::binary);
+    for(const auto& layer : layers)
+    {
+      EXPECT_NO_THROW(ffnn::load(ifs, *layer));
+    }
+  }
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input_a, hidden));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input_b, hidden));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden, output));
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Weights have one column per (padded) input, and outputs match those of unpadded weights
+  ASSERT_EQ(hidden->getWeights().cols(), hidden->inputSize());
+  ASSERT_GT(hidden->inputSize(), DIMS[0] + DIMS[1]);
+
+  const Eigen::VectorXf x_a = Eigen::VectorXf::Random(DIMS[0]);
+  const Eigen::VectorXf x_b = Eigen::VectorXf::Random(DIMS[1]);
+  Eigen::VectorXf x(DIMS[0] + DIMS[1]);
+  x << ((ids[0] < ids[1]) ? x_a : x_b), ((ids[0] < ids[1]) ? x_b : x_a);
+  (*input_a) << x_a;
+  (*input_b) << x_b;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  Eigen::VectorXf y(4);
+  (*output) >> y;
+  EXPECT_TRUE(y.isApprox(w * x + hidden->getBiases(), 1e-5f));
+}
+
 // Run tests
 int main(int argc, char** argv)
 {
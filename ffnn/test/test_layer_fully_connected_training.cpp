@@ -21,6 +21,7 @@
 #include <ffnn/layer/layer.h>
 #include <ffnn/layer/input.h>
 #include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/fully_connected_activation.h>
 #include <ffnn/layer/output.h>
 #include <ffnn/neuron/lecun_sigmoid.h>
 #include <ffnn/optimizer/gradient_descent.h>
@@ -73,6 +74,11 @@ TEST(TestLayerFullyConnectedWithOptimizers, GradientDescent)
     EXPECT_TRUE(layer->isInitialized());
   }
 
+  // Layers fed only by network inputs should not compute back-propagated error
+  EXPECT_FALSE(hidden->hasBackwardError());
+  EXPECT_TRUE(hidden->getBackwardErrorBuffer().empty());
+  EXPECT_TRUE(output->hasBackwardError());
+
   // Create some data
   Hidden::InputVector target_data = Hidden::InputVector::Ones(DIM);
   Hidden::InputVector output_data(DIM, 1);
@@ -204,6 +210,272 @@ TEST(TestLayerFullyConnectedActivationWithOptimizers, GradientDescent)
   }
 }
 
+/***********************************************************/
+// Creates network workflow with one FullyConnectedActivation
+// hidden layer and updates using a GradientDescent optimizer
+//
+// Tests:
+//    - layer::Input
+//    - layer::Output
+//    - layer::FullyConnectedActivation
+//    - optimizer::GradientDescent
+/***********************************************************/
+TEST(TestLayerFullyConnectedActivationFusedWithOptimizers, GradientDescent)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnectedActivation<float, ffnn::neuron::LeCunSigmoid>;
+  using Output = ffnn::layer::Output<float>;
+
+  // Layer sizes
+  static const Layer::SizeType DIM = 32;
+
+  // Create layers
+  auto input = boost::make_shared<Input>(DIM);
+  auto hidden = boost::make_shared<Hidden>(DIM);
+  auto output = boost::make_shared<Output>();
+
+  // Set optimizer (gradient descent)
+  {
+    using Optimizer = ffnn::optimizer::GradientDescent<Hidden::Base>;
+    hidden->setOptimizer(boost::make_shared<Optimizer>(1e-3));
+  }
+
+  // Create network
+  std::vector<Layer::Ptr> layers({input, hidden, output});
+
+  // Connect layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+
+  // Initialize and check all layers and
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+    EXPECT_TRUE(layer->isInitialized());
+  }
+
+  // Create some data
+  Hidden::InputVector input_data = Hidden::InputVector::Random(DIM);
+  Hidden::OutputVector target_data = 0.5 * Hidden::OutputVector::Ones(DIM);
+  Hidden::OutputVector output_data(DIM, 1);
+
+  // Fused output matches (activation o fully-connected)
+  (*input) << input_data;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  (*output) >> output_data;
+  Hidden::OutputVector expected_data =
+    1.7159f * (0.6666f * (hidden->getWeights() * input_data + hidden->getBiases()).array()).tanh();
+  EXPECT_TRUE(output_data.isApprox(expected_data));
+
+  // Check that error montonically decreases
+  float prev_error = std::numeric_limits<float>::infinity();
+  for (size_t idx = 0UL; idx < 100; idx++)
+  {
+    // Forward activate
+    (*input) << input_data;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> output_data;
+
+    // Compute error and check
+    double error = (target_data - output_data).norm();
+    EXPECT_LT(error, prev_error);
+
+    // Set target
+    (*output) << target_data;
+
+    // Backward propogated error
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->backward());
+    }
+
+    // Trigget optimization
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->update());
+    }
+
+    // Store previous error
+    prev_error = error;
+  }
+}
+
+/***********************************************************/
+// Creates network workflow with one FullyConnected hidden
+// layer fed by two network inputs of unaligned sizes and
+// updates using a GradientDescent optimizer
+//
+// Tests:
+//    - layer::Input
+//    - layer::Output
+//    - layer::FullyConnected
+//    - optimizer::GradientDescent
+/***********************************************************/
+TEST(TestLayerFullyConnectedMultiInputWithOptimizers, GradientDescent)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Output = ffnn::layer::Output<float>;
+
+  // Layer sizes
+  static const Layer::SizeType DIMS[2] = {3, 5};
+  static const Layer::SizeType DIM = 8;
+
+  // Create layers
+  auto input1 = boost::make_shared<Input>(DIMS[0]);
+  auto input2 = boost::make_shared<Input>(DIMS[1]);
+  auto hidden = boost::make_shared<Hidden>(DIM);
+  auto output = boost::make_shared<Output>();
+
+  // Set optimizer (gradient descent)
+  {
+    using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+    hidden->setOptimizer(boost::make_shared<Optimizer>(1e-2));
+  }
+
+  // Create network
+  std::vector<Layer::Ptr> layers({input1, input2, hidden, output});
+
+  // Connect layers
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input1, hidden));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input2, hidden));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden, output));
+
+  // Initialize and check all layers and
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+    EXPECT_TRUE(layer->isInitialized());
+  }
+
+  // Input segments are padded to an aligned offset
+  EXPECT_GE(hidden->inputSize(), DIMS[0] + DIMS[1]);
+  EXPECT_TRUE(hidden->inputSize() == ffnn::aligned::padOffset<float>(DIMS[0]) + DIMS[1] ||
+              hidden->inputSize() == ffnn::aligned::padOffset<float>(DIMS[1]) + DIMS[0]);
+  EXPECT_TRUE(ffnn::aligned::isAligned(hidden->getInputBuffer().data()));
+
+  // Create some data
+  Eigen::VectorXf input1_data = Eigen::VectorXf::Ones(DIMS[0]);
+  Eigen::VectorXf input2_data = Eigen::VectorXf::Ones(DIMS[1]);
+  Hidden::OutputVector target_data = Hidden::OutputVector::Ones(DIM);
+  Hidden::OutputVector output_data(DIM, 1);
+
+  // Check that error montonically decreases
+  float prev_error = std::numeric_limits<float>::infinity();
+  for (size_t idx = 0UL; idx < 100; idx++)
+  {
+    // Forward activate
+    (*input1) << input1_data;
+    (*input2) << input2_data;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> output_data;
+
+    // Compute error and check
+    double error = (target_data - output_data).norm();
+    EXPECT_LT(error, prev_error);
+
+    // Set target
+    (*output) << target_data;
+
+    // Backward propogated error
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->backward());
+    }
+
+    // Trigget optimization
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->update());
+    }
+
+    // Store previous error
+    prev_error = error;
+  }
+}
+
+/***********************************************************/
+// Creates network with one FullyConnected hidden layer and
+// checks that bound (zero-copy) inputs and output views
+// match copied inputs and outputs
+//
+// Tests:
+//    - layer::Input
+//    - layer::Output
+//    - layer::FullyConnected
+/***********************************************************/
+TEST(TestLayerFullyConnectedZeroCopy, BindAndView)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Output = ffnn::layer::Output<float>;
+
+  // Layer sizes
+  static const Layer::SizeType DIM = 32;
+
+  // Create layers
+  auto input = boost::make_shared<Input>(DIM);
+  auto hidden = boost::make_shared<Hidden>(DIM);
+  auto output = boost::make_shared<Output>();
+
+  // Create network
+  std::vector<Layer::Ptr> layers({input, hidden, output});
+
+  // Connect layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+
+  // Initialize and check all layers and
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+    EXPECT_TRUE(layer->isInitialized());
+  }
+
+  // Create some data (in aligned storage)
+  ffnn::aligned::Buffer<float> input_data(DIM);
+  Eigen::Map<Hidden::InputVector>(input_data.data(), DIM).setRandom();
+  Hidden::InputVector zero_data = Hidden::InputVector::Zero(DIM);
+  Hidden::OutputVector copied_output_data(DIM, 1);
+
+  // Forward activate with copied inputs/outputs
+  (*input) << input_data;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  (*output) >> copied_output_data;
+
+  // Forward activate with bound inputs
+  EXPECT_TRUE(input->bind(input_data.data()));
+  (*input) << zero_data;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  EXPECT_TRUE(output->getOutputView().isApprox(copied_output_data));
+  EXPECT_TRUE(input->unbind());
+}
+
 // Run tests
 int main(int argc, char** argv)
 {
@@ -0,0 +1,202 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+
+/// Input -> FullyConnected -> Activation -> Output
+struct Chain
+{
+  boost::shared_ptr<Input> input;
+  boost::shared_ptr<Hidden> hidden;
+  boost::shared_ptr<Output> output;
+  std::vector<Layer::Ptr> layers;
+
+  Chain(Layer::SizeType inputs, Layer::SizeType outputs) :
+    input(boost::make_shared<Input>(inputs)),
+    hidden(boost::make_shared<Hidden>(outputs)),
+    output(boost::make_shared<Output>())
+  {
+    hidden->setOptimizer(boost::make_shared<Optimizer>(1e-1));
+    layers = {input, hidden, boost::make_shared<Activation>(), output};
+    for (std::size_t idx = 1UL; idx < layers.size(); idx++)
+    {
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+    }
+    for (const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->initialize());
+    }
+  }
+
+  /// Runs one training step, with inputs already set
+  Eigen::VectorXf train(const Eigen::VectorXf& target)
+  {
+    Eigen::VectorXf y(output->inputSize());
+    for (const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> y;
+    (*output) << target;
+    for (const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->backward());
+    }
+    for (const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->update());
+    }
+    return y;
+  }
+};
+
+/***********************************************************/
+// Trains a network with sparse inputs alongside an identical
+// network with the same inputs, set densely
+//
+// Tests:
+//    - layer::Input::setSparse
+//    - layer::Input::operator<<(SparseVector)
+//    - layer::FullyConnected (sparse forward)
+//    - optimizer::GradientDescent[FullyConnected] (sparse updates)
+/***********************************************************/
+TEST(TestLayerInputSparse, MatchesDense)
+{
+  static const Layer::SizeType INPUTS = 257;
+  static const Layer::SizeType OUTPUTS = 9;
+  static const Layer::SizeType UNTOUCHED = 200;
+
+  Chain dense(INPUTS, OUTPUTS);
+  Chain sparse(INPUTS, OUTPUTS);
+  ASSERT_TRUE(sparse.hidden->setParameters(dense.hidden->getWeights(), dense.hidden->getBiases()));
+  const Hidden::WeightMatrix initial = dense.hidden->getWeights();
+
+  const Eigen::VectorXf target = Eigen::VectorXf::Constant(OUTPUTS, 0.25f);
+  for (int step = 0; step < 24; step++)
+  {
+    // A few active inputs, never including UNTOUCHED
+    Eigen::SparseVector<float> x(INPUTS);
+    for (int k = 0; k < 1 + step % 7; k++)
+    {
+      x.coeffRef((step * 37 + k * 61) % UNTOUCHED) = 1.0f + 0.1f * k;
+    }
+    const Eigen::VectorXf x_dense = x.toDense();
+
+    (*dense.input) << x_dense;
+    if (step % 8 == 5)
+    {
+      // Dense inputs in between sparse inputs
+      (*sparse.input) << x_dense;
+      EXPECT_FALSE(sparse.hidden->hasActiveInputs());
+    }
+    else
+    {
+      (*sparse.input) << x;
+      EXPECT_TRUE(sparse.hidden->hasActiveInputs());
+      EXPECT_EQ(sparse.hidden->activeInputCount(), x.nonZeros());
+    }
+
+    // Stored inputs match, in full
+    EXPECT_TRUE(Eigen::Map<const Eigen::VectorXf>(sparse.hidden->getInputData(), INPUTS).isApprox(x_dense));
+
+    const Eigen::VectorXf expected = dense.train(target);
+    const Eigen::VectorXf result = sparse.train(target);
+    EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+  }
+
+  EXPECT_TRUE(sparse.hidden->getWeights().isApprox(dense.hidden->getWeights(), 1e-5f));
+  EXPECT_TRUE(sparse.hidden->getBiases().isApprox(dense.hidden->getBiases(), 1e-5f));
+  EXPECT_FALSE(sparse.hidden->getWeights().isApprox(initial));
+  EXPECT_TRUE(sparse.hidden->getWeights().rightCols(INPUTS - UNTOUCHED) == initial.rightCols(INPUTS - UNTOUCHED));
+}
+
+/***********************************************************/
+// Sparse inputs reach every subsequent layer
+//
+// Tests:
+//    - layer::Input::setSparse
+/***********************************************************/
+TEST(TestLayerInputSparse, FanOut)
+{
+  static const Layer::SizeType INPUTS = 64;
+
+  auto input = boost::make_shared<Input>(INPUTS);
+  auto hidden1 = boost::make_shared<Hidden>(8);
+  auto hidden2 = boost::make_shared<Hidden>(4);
+  auto output1 = boost::make_shared<Output>();
+  auto output2 = boost::make_shared<Output>();
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, hidden1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, hidden2));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden1, output1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden2, output2));
+
+  std::vector<Layer::Ptr> layers({input, hidden1, hidden2, output1, output2});
+  for (const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  const Layer::SizeType indices[] = {3, 17, 40, 41, 63};
+  const float values[] = {1.0f, -2.0f, 0.5f, 3.0f, -1.0f};
+  Eigen::VectorXf x_dense = Eigen::VectorXf::Zero(INPUTS);
+  for (int k = 0; k < 5; k++)
+  {
+    x_dense(indices[k]) = values[k];
+  }
+
+  // Overwrite dense inputs, so that stale values would be visible
+  (*input) << Eigen::VectorXf::Ones(INPUTS).eval();
+  input->setSparse(indices, values, 5);
+  for (const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  EXPECT_TRUE(hidden1->hasActiveInputs());
+  EXPECT_TRUE(hidden2->hasActiveInputs());
+
+  Eigen::VectorXf y1(8), y2(4);
+  (*output1) >> y1;
+  (*output2) >> y2;
+  EXPECT_TRUE(y1.isApprox(hidden1->getWeights() * x_dense + hidden1->getBiases(), 1e-5f));
+  EXPECT_TRUE(y2.isApprox(hidden2->getWeights() * x_dense + hidden2->getBiases(), 1e-5f));
+
+  // NOTE: Other subsequent layers read inputs in place, from storage of the first
+  EXPECT_TRUE(Eigen::Map<const Eigen::VectorXf>(hidden1->getInputData(), INPUTS) == x_dense);
+
+  // Dense inputs clear active inputs
+  (*input) << x_dense;
+  EXPECT_FALSE(hidden1->hasActiveInputs());
+  EXPECT_FALSE(hidden2->hasActiveInputs());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
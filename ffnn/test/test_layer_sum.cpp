@@ -0,0 +1,132 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/layer/sum.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Sum = ffnn::layer::Sum<float>;
+using Output = ffnn::layer::Output<float>;
+using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+using Plan = ffnn::network::InferencePlan<float>;
+
+/***********************************************************/
+// Residual block: y1 = (W1 x + b1) + (W2 x + b2) + x, where
+// the second branch also feeds another output y2
+//
+// Tests:
+//    - layer::Sum
+//    - layer::Sum::infer
+//    - Error hand-off to branches (in place and copied)
+/***********************************************************/
+TEST(TestLayerSum, Residual)
+{
+  static const int SIZE = 7;
+  static const float LEARNING_RATE = 0.1f;
+
+  auto input = boost::make_shared<Input>(SIZE);
+  auto branch1 = boost::make_shared<Hidden>(SIZE);
+  auto branch2 = boost::make_shared<Hidden>(SIZE);
+  auto sum = boost::make_shared<Sum>();
+  auto output1 = boost::make_shared<Output>();
+  auto output2 = boost::make_shared<Output>();
+  branch1->setOptimizer(boost::make_shared<Optimizer>(LEARNING_RATE));
+  branch2->setOptimizer(boost::make_shared<Optimizer>(LEARNING_RATE));
+
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, branch1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, branch2));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, sum));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(branch1, sum));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(branch2, sum));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(sum, output1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(branch2, output2));
+
+  std::vector<Layer::Ptr> layers({input, branch1, branch2, sum, output1, output2});
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+  EXPECT_EQ(sum->outputSize(), SIZE);
+
+  const Hidden::WeightMatrix w1 = branch1->getWeights();
+  const Hidden::WeightMatrix w2 = branch2->getWeights();
+  const Hidden::BiasVector b1 = branch1->getBiases();
+  const Hidden::BiasVector b2 = branch2->getBiases();
+
+  // Forward
+  const Eigen::VectorXf x = Eigen::VectorXf::Random(SIZE);
+  const Eigen::VectorXf expected1 = (w1 * x + b1) + (w2 * x + b2) + x;
+  const Eigen::VectorXf expected2 = w2 * x + b2;
+
+  (*input) << x;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  Eigen::VectorXf y1(SIZE), y2(SIZE);
+  (*output1) >> y1;
+  (*output2) >> y2;
+  EXPECT_TRUE(y1.isApprox(expected1, 1e-5f));
+  EXPECT_TRUE(y2.isApprox(expected2, 1e-5f));
+
+  // Stateless forward
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  Plan::Workspace workspace = plan.createWorkspace();
+  Eigen::VectorXf r1(SIZE), r2(SIZE);
+  float* outputs[2] = {r1.data(), r2.data()};
+  const float* inputs[1] = {x.data()};
+  EXPECT_TRUE(plan.forward(inputs, outputs, 1, workspace));
+  EXPECT_TRUE(r1.isApprox(expected1, 1e-5f));
+  EXPECT_TRUE(r2.isApprox(expected2, 1e-5f));
+
+  // Backward: every branch receives the error of the sum; the second branch also
+  // receives the error of the second output
+  const Eigen::VectorXf t1 = Eigen::VectorXf::Random(SIZE);
+  const Eigen::VectorXf t2 = Eigen::VectorXf::Random(SIZE);
+  (*output1) << t1;
+  (*output2) << t2;
+  const Eigen::VectorXf e1 = Eigen::Map<const Eigen::VectorXf>(output1->getBackwardErrorBuffer().data(), SIZE);
+  const Eigen::VectorXf e2 = Eigen::Map<const Eigen::VectorXf>(output2->getBackwardErrorBuffer().data(), SIZE);
+  for (auto itr = layers.rbegin(); itr != layers.rend(); ++itr)
+  {
+    EXPECT_TRUE((*itr)->backward());
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->update());
+  }
+
+  const Hidden::WeightMatrix expected_w1 = w1 - LEARNING_RATE * e1 * x.transpose();
+  const Hidden::WeightMatrix expected_w2 = w2 - LEARNING_RATE * (e1 + e2) * x.transpose();
+  EXPECT_TRUE(branch1->getWeights().isApprox(expected_w1, 1e-5f));
+  EXPECT_TRUE(branch2->getWeights().isApprox(expected_w2, 1e-5f));
+  EXPECT_TRUE(branch1->getBiases().isApprox(b1 - LEARNING_RATE * e1, 1e-5f));
+  EXPECT_TRUE(branch2->getBiases().isApprox(b2 - LEARNING_RATE * (e1 + e2), 1e-5f));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
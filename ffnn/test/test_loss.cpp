@@ -0,0 +1,133 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <cmath>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/loss/loss.h>
+#include <ffnn/loss/binary_cross_entropy.h>
+#include <ffnn/loss/huber.h>
+#include <ffnn/loss/mean_squared_error.h>
+#include <ffnn/loss/softmax_cross_entropy.h>
+
+/// Batch matrix type
+using BatchMatrix = ffnn::loss::Loss<double>::BatchMatrix;
+
+/**
+ * @brief Checks analytical loss gradient against a central finite-difference estimate
+ */
+void checkGradient(const ffnn::loss::Loss<double>& loss_fn,
+                   const BatchMatrix& output,
+                   const BatchMatrix& target)
+{
+  static const double EPS = 1e-6;
+
+  // Analytical gradient
+  BatchMatrix gradient(output.rows(), output.cols());
+  loss_fn.compute(output, target, gradient);
+
+  // Numerical gradient
+  BatchMatrix scratch(output.rows(), output.cols());
+  for (BatchMatrix::Index jdx = 0; jdx < output.cols(); jdx++)
+  {
+    for (BatchMatrix::Index idx = 0; idx < output.rows(); idx++)
+    {
+      BatchMatrix perturbed = output;
+      perturbed(idx, jdx) += EPS;
+      const double upper = loss_fn.compute(perturbed, target, scratch);
+      perturbed(idx, jdx) -= 2 * EPS;
+      const double lower = loss_fn.compute(perturbed, target, scratch);
+      EXPECT_NEAR(gradient(idx, jdx), (upper - lower) / (2 * EPS), 1e-6);
+    }
+  }
+}
+
+/***********************************************************/
+// Tests:
+//    - loss::MeanSquaredError
+/***********************************************************/
+TEST(TestLoss, MeanSquaredError)
+{
+  const BatchMatrix output = BatchMatrix::Random(8, 4);
+  const BatchMatrix target = BatchMatrix::Random(8, 4);
+
+  ffnn::loss::MeanSquaredError<double> loss_fn;
+  checkGradient(loss_fn, output, target);
+
+  // Loss is averaged over the batch
+  BatchMatrix gradient(8, 4);
+  EXPECT_NEAR(loss_fn.compute(output, target, gradient),
+              0.5 * (output - target).squaredNorm() / 4, 1e-12);
+}
+
+/***********************************************************/
+// Tests:
+//    - loss::Huber
+/***********************************************************/
+TEST(TestLoss, Huber)
+{
+  const BatchMatrix output = 4 * BatchMatrix::Random(8, 4);
+  const BatchMatrix target = BatchMatrix::Random(8, 4);
+
+  ffnn::loss::Huber<double> loss_fn(0.5);
+  checkGradient(loss_fn, output, target);
+
+  // Gradient is bounded by delta (scaled by batch size)
+  BatchMatrix gradient(8, 4);
+  loss_fn.compute(output, target, gradient);
+  EXPECT_LE(gradient.cwiseAbs().maxCoeff(), 0.5 / 4 + 1e-12);
+}
+
+/***********************************************************/
+// Tests:
+//    - loss::BinaryCrossEntropy
+/***********************************************************/
+TEST(TestLoss, BinaryCrossEntropy)
+{
+  const BatchMatrix output = 4 * BatchMatrix::Random(8, 4);
+  const BatchMatrix target = (BatchMatrix::Random(8, 4).array() > 0).cast<double>();
+
+  ffnn::loss::BinaryCrossEntropy<double> loss_fn;
+  checkGradient(loss_fn, output, target);
+
+  // Compare against the naive (unfused) formulation
+  const BatchMatrix p = (1 + (-output).array().exp()).inverse();
+  const double expected =
+    -(target.array() * p.array().log() + (1 - target.array()) * (1 - p.array()).log()).sum() / 4;
+  BatchMatrix gradient(8, 4);
+  EXPECT_NEAR(loss_fn.compute(output, target, gradient), expected, 1e-9);
+}
+
+/***********************************************************/
+// Tests:
+//    - loss::SoftmaxCrossEntropy
+/***********************************************************/
+TEST(TestLoss, SoftmaxCrossEntropy)
+{
+  const BatchMatrix output = 4 * BatchMatrix::Random(8, 4);
+  BatchMatrix target = BatchMatrix::Zero(8, 4);
+  for (BatchMatrix::Index jdx = 0; jdx < target.cols(); jdx++)
+  {
+    target(jdx, jdx) = 1;
+  }
+
+  ffnn::loss::SoftmaxCrossEntropy<double> loss_fn;
+  checkGradient(loss_fn, output, target);
+
+  // Large logits do not overflow
+  BatchMatrix gradient(8, 4);
+  EXPECT_TRUE(std::isfinite(loss_fn.compute(1e4 * output, target, gradient)));
+  EXPECT_TRUE(gradient.allFinite());
+}
+
+// Run tests
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,258 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/aligned_types.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/memory/arena_resource.h>
+#include <ffnn/memory/page_resource.h>
+#include <ffnn/memory/resource.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+/***********************************************************/
+// Checks that buffers created within a ScopedResource are
+// allocated from that resource
+//
+// Tests:
+//    - memory::ScopedResource
+//    - memory::ArenaResource
+/***********************************************************/
+TEST(TestMemoryResource, ArenaScoped)
+{
+  ffnn::memory::ArenaResource arena(4096);
+  EXPECT_EQ(ffnn::memory::getResource(), ffnn::memory::heapResource());
+  {
+    ffnn::memory::ScopedResource scope(&arena);
+    EXPECT_EQ(ffnn::memory::getResource(), &arena);
+
+    ffnn::aligned::Buffer<float> a(3);
+    ffnn::aligned::Buffer<float> b(5);
+    ffnn::aligned::Buffer<float> c(2000);
+
+    // Allocations are aligned and packed into arena blocks
+    EXPECT_TRUE(ffnn::aligned::isAligned(a.data()));
+    EXPECT_TRUE(ffnn::aligned::isAligned(b.data()));
+    EXPECT_TRUE(ffnn::aligned::isAligned(c.data()));
+    EXPECT_LT(reinterpret_cast<std::uintptr_t>(b.data()) - reinterpret_cast<std::uintptr_t>(a.data()),
+              2UL * ffnn::aligned::Alignment);
+    EXPECT_GE(arena.used(), (3UL + 5UL + 2000UL) * sizeof(float));
+    EXPECT_GE(arena.reserved(), arena.used());
+  }
+  EXPECT_EQ(ffnn::memory::getResource(), ffnn::memory::heapResource());
+}
+
+/***********************************************************/
+// Checks that large allocations are page-mapped and
+// huge-page aligned
+//
+// Tests:
+//    - memory::PageResource
+/***********************************************************/
+TEST(TestMemoryResource, PageMapped)
+{
+  ffnn::memory::PageResource pages(ffnn::memory::PageResource::HugePages::Transparent);
+  ffnn::aligned::Buffer<float> small(16, 1.0f, ffnn::aligned::Allocator<float>(&pages));
+  ffnn::aligned::Buffer<float> large(1UL << 20, 1.0f, ffnn::aligned::Allocator<float>(&pages));
+
+  EXPECT_TRUE(ffnn::aligned::isAligned(small.data()));
+#if defined(__linux__)
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large.data()) % ffnn::memory::PageResource::HugePageSize, 0UL);
+#endif
+  EXPECT_EQ(large.back(), 1.0f);
+}
+
+/***********************************************************/
+// Builds a network within an arena and checks that layer
+// buffers and weights are placed in it
+//
+// Tests:
+//    - memory::ScopedResource
+//    - layer::FullyConnected
+/***********************************************************/
+TEST(TestMemoryResource, NetworkInArena)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Output = ffnn::layer::Output<float>;
+
+  ffnn::memory::ArenaResource arena;
+  ffnn::memory::ScopedResource scope(&arena);
+
+  auto input = boost::make_shared<Input>(64);
+  auto hidden = boost::make_shared<Hidden>(64);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input, hidden, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Weights and both layer input buffers come from the arena
+  EXPECT_GE(arena.used(), (64UL * 64UL + 2UL * 64UL) * sizeof(float));
+
+  EXPECT_TRUE(arena.owns(hidden->getWeights().data()));
+  EXPECT_TRUE(arena.owns(hidden->getInputBuffer().data()));
+  EXPECT_TRUE(arena.owns(output->getInputBuffer().data()));
+  EXPECT_TRUE(ffnn::aligned::isAligned(hidden->getWeights().data()));
+}
+
+/***********************************************************/
+// Builds a trained layer within an arena and checks that
+// optimizer gradients are placed in it with the weights
+//
+// Tests:
+//    - memory::ScopedResource
+//    - optimizer::GradientDescent
+/***********************************************************/
+TEST(TestMemoryResource, OptimizerInArena)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden = ffnn::layer::FullyConnected<float>;
+  using Output = ffnn::layer::Output<float>;
+  using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+
+  ffnn::memory::ArenaResource arena;
+  ffnn::memory::ScopedResource scope(&arena);
+
+  auto input = boost::make_shared<Input>(64);
+  auto hidden = boost::make_shared<Hidden>(64);
+  auto output = boost::make_shared<Output>();
+  hidden->setOptimizer(boost::make_shared<Optimizer>(1e-3));
+  std::vector<Layer::Ptr> layers({input, hidden, output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Weights, gradients and both layer input buffers come from the arena
+  EXPECT_GE(arena.used(), (2UL * 64UL * 64UL + 4UL * 64UL) * sizeof(float));
+  EXPECT_TRUE(arena.owns(hidden->getWeights().data()));
+}
+
+/***********************************************************/
+// Checks that a scoped resource only applies to buffers
+// created on the thread which set it
+//
+// Tests:
+//    - memory::ScopedResource (thread-local)
+/***********************************************************/
+TEST(TestMemoryResource, ScopedPerThread)
+{
+  ffnn::memory::ArenaResource arena(4096);
+  ffnn::memory::ScopedResource scope(&arena);
+
+  ffnn::memory::Resource* other_resource = NULL;
+  bool other_in_arena = true;
+  std::thread worker([&]()
+  {
+    other_resource = ffnn::memory::getResource();
+    const ffnn::aligned::Buffer<float> buffer(256);
+    other_in_arena = arena.owns(buffer.data());
+  });
+  worker.join();
+
+  // Other threads allocate from their own (heap) resource
+  EXPECT_EQ(other_resource, ffnn::memory::heapResource());
+  EXPECT_FALSE(other_in_arena);
+
+  // This thread still allocates from the arena
+  ffnn::aligned::Buffer<float> buffer(256);
+  EXPECT_EQ(ffnn::memory::getResource(), &arena);
+  EXPECT_TRUE(arena.owns(buffer.data()));
+}
+
+/// Heap resource which tracks its live blocks
+class TrackingResource :
+  public ffnn::memory::Resource
+{
+public:
+  void* allocate(std::size_t bytes, std::size_t alignment)
+  {
+    void* ptr = ffnn::memory::heapResource()->allocate(bytes, alignment);
+    live.insert(ptr);
+    return ptr;
+  }
+
+  void deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+  {
+    EXPECT_EQ(live.erase(ptr), 1UL);
+    ffnn::memory::heapResource()->deallocate(ptr, bytes, alignment);
+  }
+
+  /// Blocks which have not been deallocated
+  std::set<void*> live;
+};
+
+/***********************************************************/
+// Checks that buffers from different resources may be
+// swapped and move-assigned, and that blocks are returned to
+// the resource they came from
+//
+// Tests:
+//    - aligned::Allocator (propagation)
+/***********************************************************/
+TEST(TestMemoryResource, SwapAcrossResources)
+{
+  TrackingResource tracking;
+  {
+    ffnn::aligned::Buffer<float> tracked(100, 1.0f, ffnn::aligned::Allocator<float>(&tracking));
+    ffnn::aligned::Buffer<float> heap(50, 2.0f);
+    const float* tracked_data = tracked.data();
+
+    // Swapped buffers exchange resources along with their blocks
+    tracked.swap(heap);
+    EXPECT_EQ(heap.data(), tracked_data);
+    EXPECT_EQ(heap.get_allocator().resource, &tracking);
+    EXPECT_EQ(tracked.get_allocator().resource, ffnn::memory::heapResource());
+
+    // Move-assigned buffers take the resource of their source
+    ffnn::aligned::Buffer<float> moved(10, 3.0f);
+    moved = std::move(heap);
+    EXPECT_EQ(moved.data(), tracked_data);
+    EXPECT_EQ(moved.get_allocator().resource, &tracking);
+
+    // Copy-assigned buffers keep their own resource
+    const ffnn::aligned::Allocator<float> allocator(&tracking);
+    ffnn::aligned::Buffer<float> copied(allocator);
+    copied = tracked;
+    EXPECT_EQ(copied.get_allocator().resource, &tracking);
+    EXPECT_EQ(tracking.live.size(), 2UL);
+  }
+  EXPECT_TRUE(tracking.live.empty());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
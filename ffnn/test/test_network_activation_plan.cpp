@@ -0,0 +1,144 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/activation_plan.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Plan = ffnn::network::ActivationPlan<float>;
+
+/// Runs one forward pass
+Eigen::VectorXf forward(const std::vector<Layer::Ptr>& layers,
+                        Input& input,
+                        Output& output,
+                        const Eigen::VectorXf& input_data)
+{
+  Eigen::VectorXf output_data(output.inputSize());
+  input << input_data;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  output >> output_data;
+  return output_data;
+}
+
+/***********************************************************/
+// Plans a chain network into two shared slots and checks
+// outputs against unplanned storage
+//
+// Tests:
+//    - network::ActivationPlan
+//    - layer::Layer::relocateInput
+/***********************************************************/
+TEST(TestNetworkActivationPlan, Chain)
+{
+  // Create layers
+  auto input = boost::make_shared<Input>(16);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input,
+                                  boost::make_shared<Hidden>(32),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(8),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(4),
+                                  output});
+
+  // Connect and initialize layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  const Eigen::VectorXf input_data = Eigen::VectorXf::Random(16);
+  const Eigen::VectorXf expected = forward(layers, *input, *output, input_data);
+
+  Plan plan;
+  ASSERT_TRUE(plan.apply(layers));
+  EXPECT_EQ(plan.slotCount(), 2UL);
+  EXPECT_LE(plan.planned(), 2UL * 32UL);
+  EXPECT_EQ(plan.unplanned(), 16UL + 32UL + 32UL + 8UL + 8UL + 4UL);
+  EXPECT_TRUE(layers[1]->getInputBuffer().empty());
+  EXPECT_TRUE(forward(layers, *input, *output, input_data).isApprox(expected));
+
+  // Restore raw input buffers
+  plan.release();
+  EXPECT_FALSE(layers[1]->getInputBuffer().empty());
+  EXPECT_EQ(layers[1]->getInputData(), layers[1]->getInputBuffer().data());
+  EXPECT_TRUE(forward(layers, *input, *output, input_data).isApprox(expected));
+}
+
+/***********************************************************/
+// Plans a network with a multi-input (concatenating) layer
+//
+// Tests:
+//    - network::ActivationPlan
+//    - layer::Layer::relocateInput
+/***********************************************************/
+TEST(TestNetworkActivationPlan, Concatenation)
+{
+  // Create layers
+  auto input1 = boost::make_shared<Input>(8);
+  auto input2 = boost::make_shared<Input>(5);
+  auto hidden1 = boost::make_shared<Hidden>(16);
+  auto hidden2 = boost::make_shared<Hidden>(16);
+  auto hidden3 = boost::make_shared<Hidden>(4);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input1, input2, hidden1, hidden2, hidden3, output});
+
+  // Connect layers; hidden3 concatenates the outputs of hidden1 and hidden2
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input1, hidden1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input2, hidden2));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden1, hidden3));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden2, hidden3));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden3, output));
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  const Eigen::VectorXf input1_data = Eigen::VectorXf::Random(8);
+  const Eigen::VectorXf input2_data = Eigen::VectorXf::Random(5);
+  (*input2) << input2_data;
+  const Eigen::VectorXf expected = forward(layers, *input1, *output, input1_data);
+
+  Plan plan;
+  ASSERT_TRUE(plan.apply(layers));
+
+  // hidden1 output must stay live (within hidden3 input) while hidden2 runs
+  EXPECT_EQ(plan.slotCount(), 3UL);
+  (*input2) << input2_data;
+  EXPECT_TRUE(forward(layers, *input1, *output, input1_data).isApprox(expected));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/fully_connected_activation.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/batch_queue.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Fused = ffnn::layer::FullyConnectedActivation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Plan = ffnn::network::InferencePlan<float>;
+using Queue = ffnn::network::BatchQueue<float>;
+
+/***********************************************************/
+// Submits single-sample requests from several threads and
+// checks results and batching statistics
+//
+// Tests:
+//    - network::BatchQueue
+/***********************************************************/
+TEST(TestNetworkBatchQueue, ConcurrentRequests)
+{
+  static const int THREADS = 4;
+  static const int REQUESTS = 64;
+  static const int SAMPLES = 8;
+
+  // Create layers
+  auto input = boost::make_shared<Input>(10);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input,
+                                  boost::make_shared<Fused>(16),
+                                  boost::make_shared<Hidden>(4),
+                                  output});
+
+  // Connect and initialize layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Reference outputs from the layer graph
+  const Eigen::MatrixXf input_data = Eigen::MatrixXf::Random(10, SAMPLES);
+  Eigen::MatrixXf expected(4, SAMPLES);
+  for (int col = 0; col < SAMPLES; col++)
+  {
+    Eigen::VectorXf sample = input_data.col(col);
+    Eigen::VectorXf result(4);
+    (*input) << sample;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> result;
+    expected.col(col) = result;
+  }
+
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  {
+    Queue queue(plan, Queue::Parameters(8, std::chrono::microseconds(2000)));
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(THREADS, 0);
+    for (int tdx = 0; tdx < THREADS; tdx++)
+    {
+      threads.emplace_back([&queue, &input_data, &expected, &failures, tdx]()
+      {
+        for (int itr = 0; itr < REQUESTS; itr++)
+        {
+          const int col = (itr + tdx) % SAMPLES;
+          std::future<Queue::SampleVector> result = queue.submit(input_data.col(col));
+          if (!result.get().isApprox(expected.col(col), 1e-5f))
+          {
+            failures[tdx]++;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    for (const auto& count : failures)
+    {
+      EXPECT_EQ(count, 0);
+    }
+
+    const Queue::Metrics metrics = queue.getMetrics();
+    EXPECT_EQ(metrics.requests, static_cast<std::size_t>(THREADS * REQUESTS));
+    ASSERT_EQ(metrics.batch_size_histogram.size(), 9UL);
+    EXPECT_EQ(metrics.batch_size_histogram[0], 0UL);
+    std::size_t total = 0;
+    for (std::size_t size = 1; size < metrics.batch_size_histogram.size(); size++)
+    {
+      total += size * metrics.batch_size_histogram[size];
+    }
+    EXPECT_EQ(total, metrics.requests);
+    EXPECT_LE(metrics.meanQueueingDelay(), metrics.max_queueing_delay);
+
+    queue.resetMetrics();
+    EXPECT_EQ(queue.getMetrics().batches(), 0UL);
+  }
+}
+
+/***********************************************************/
+// Fills a batch in one burst, and checks that requests left
+// pending at destruction are still completed
+//
+// Tests:
+//    - network::BatchQueue
+/***********************************************************/
+TEST(TestNetworkBatchQueue, FullBatchAndDrain)
+{
+  // Create layers
+  auto input = boost::make_shared<Input>(6);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input, boost::make_shared<Hidden>(3), output});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+
+  const Eigen::VectorXf sample = Eigen::VectorXf::Random(6);
+  std::vector<std::future<Queue::SampleVector>> results;
+  {
+    // Long deadline: only a full batch or shutdown releases requests
+    Queue queue(plan, Queue::Parameters(4, std::chrono::microseconds(10000000)));
+    for (int idx = 0; idx < 6; idx++)
+    {
+      results.push_back(queue.submit(sample));
+    }
+    results.front().wait();
+    EXPECT_EQ(queue.getMetrics().batch_size_histogram[4], 1UL);
+  }
+
+  Eigen::VectorXf expected(3);
+  Plan::Workspace workspace = plan.createWorkspace();
+  EXPECT_TRUE(plan.forward(sample, expected, workspace));
+  for (auto& result : results)
+  {
+    EXPECT_TRUE(result.get().isApprox(expected, 1e-5f));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,183 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <cstdlib>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/data_parallel.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Optimizer = ffnn::optimizer::GradientDescent<Hidden>;
+using Trainer = ffnn::network::DataParallel<float>;
+
+// Network sizes
+static const int INPUTS = 8;
+static const int OUTPUTS = 4;
+static const int SAMPLES = 37;
+
+/**
+ * @brief Creates a set of network replicas; the first replica's parameters are seeded
+ */
+std::vector<Trainer::LayerSequence> createReplicas(int count)
+{
+  std::vector<Trainer::LayerSequence> replicas;
+  for (int rdx = 0; rdx < count; rdx++)
+  {
+    auto hidden1 = boost::make_shared<Hidden>(16);
+    auto hidden2 = boost::make_shared<Hidden>(OUTPUTS);
+    hidden1->setOptimizer(boost::make_shared<Optimizer>(1e-2));
+    hidden2->setOptimizer(boost::make_shared<Optimizer>(1e-2));
+
+    Trainer::LayerSequence layers({boost::make_shared<Input>(INPUTS),
+                                   hidden1,
+                                   boost::make_shared<Activation>(),
+                                   hidden2,
+                                   boost::make_shared<Output>()});
+    for (size_t idx = 1UL; idx < layers.size(); idx++)
+    {
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+    }
+
+    std::srand(rdx ? rdx : 1234);
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->initialize());
+    }
+    replicas.push_back(layers);
+  }
+  return replicas;
+}
+
+/**
+ * @brief Trains a set of replicas and returns the final weights of the last layer
+ */
+Hidden::WeightMatrix train(int replica_count, float& first_error, float& last_error)
+{
+  std::srand(42);
+  const Eigen::MatrixXf inputs = Eigen::MatrixXf::Random(INPUTS, SAMPLES);
+  const Eigen::MatrixXf targets = 0.5f * Eigen::MatrixXf::Random(OUTPUTS, SAMPLES);
+
+  const auto replicas = createReplicas(replica_count);
+  Trainer trainer;
+  EXPECT_TRUE(trainer.setup(replicas));
+  EXPECT_EQ(trainer.replicaCount(), static_cast<size_t>(replica_count));
+
+  // Replicas view the parameters of the first replica
+  for (const auto& replica : replicas)
+  {
+    EXPECT_EQ(boost::static_pointer_cast<Hidden>(replica[1])->getWeights().data(),
+              boost::static_pointer_cast<Hidden>(replicas[0][1])->getWeights().data());
+    EXPECT_EQ(boost::static_pointer_cast<Hidden>(replica[3])->getBiases().data(),
+              boost::static_pointer_cast<Hidden>(replicas[0][3])->getBiases().data());
+  }
+
+  const Trainer::SampleLoader load_inputs = [&inputs](const Trainer::LayerSequence& layers, Trainer::SizeType sdx)
+  {
+    (*boost::static_pointer_cast<Input>(layers.front())) << inputs.col(sdx);
+    return true;
+  };
+  const Trainer::SampleLoader load_targets = [&targets](const Trainer::LayerSequence& layers, Trainer::SizeType sdx)
+  {
+    (*boost::static_pointer_cast<Output>(layers.back())) << targets.col(sdx);
+    return true;
+  };
+
+  // Mean error over all samples with the current (shared) parameters
+  const auto error = [&]()
+  {
+    float total = 0;
+    Eigen::VectorXf result(OUTPUTS);
+    for (int sdx = 0; sdx < SAMPLES; sdx++)
+    {
+      load_inputs(replicas[0], sdx);
+      for(const auto& layer : replicas[0])
+      {
+        layer->forward();
+      }
+      (*boost::static_pointer_cast<Output>(replicas[0].back())) >> result;
+      total += (result - targets.col(sdx)).norm();
+    }
+    return total / SAMPLES;
+  };
+
+  first_error = error();
+  for (int itr = 0; itr < 50; itr++)
+  {
+    EXPECT_TRUE(trainer.step(SAMPLES, load_inputs, load_targets));
+  }
+  last_error = error();
+  return boost::static_pointer_cast<Hidden>(replicas[0][3])->getWeights();
+}
+
+/***********************************************************/
+// Trains with several replicas and checks that results are
+// reproducible and match single-replica training
+//
+// Tests:
+//    - network::DataParallel
+//    - layer::FullyConnected::shareParameters
+//    - layer::FullyConnected::mergeGradients
+//    - optimizer::GradientDescent::merge
+/***********************************************************/
+TEST(TestNetworkDataParallel, Training)
+{
+  float first_error[3], last_error[3];
+  const Hidden::WeightMatrix serial = train(1, first_error[0], last_error[0]);
+  const Hidden::WeightMatrix parallel = train(4, first_error[1], last_error[1]);
+  const Hidden::WeightMatrix repeated = train(4, first_error[2], last_error[2]);
+
+  // Training reduces error
+  EXPECT_LT(last_error[0], first_error[0]);
+  EXPECT_LT(last_error[1], first_error[1]);
+
+  // Reduced gradient is deterministic for a fixed replica count
+  EXPECT_TRUE((parallel.array() == repeated.array()).all());
+  EXPECT_EQ(last_error[1], last_error[2]);
+
+  // ... and matches single-replica training up to summation order
+  EXPECT_FLOAT_EQ(first_error[0], first_error[1]);
+  EXPECT_TRUE(parallel.isApprox(serial, 1e-4f));
+}
+
+/***********************************************************/
+// Checks that mismatched replicas are rejected
+//
+// Tests:
+//    - network::DataParallel
+/***********************************************************/
+TEST(TestNetworkDataParallel, MismatchedReplicas)
+{
+  auto replicas = createReplicas(2);
+  replicas[1].pop_back();
+
+  Trainer trainer;
+  EXPECT_FALSE(trainer.setup(replicas));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/fold.h>
+#include <ffnn/network/graph.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+#include <ffnn/neuron/linear.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Identity = ffnn::layer::Activation<float, ffnn::neuron::Linear>;
+using Sigmoid = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Graph = ffnn::network::Graph<float>;
+using Plan = ffnn::network::InferencePlan<float>;
+
+/// Connects layers in a chain, and initializes them
+void createChain(const std::vector<Layer::Ptr>& layers)
+{
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+}
+
+/// Runs samples through the layer graph
+Eigen::MatrixXf forward(const std::vector<Layer::Ptr>& layers,
+                        Input& input,
+                        Output& output,
+                        const Eigen::MatrixXf& input_data)
+{
+  Eigen::MatrixXf result(output.inputSize(), input_data.cols());
+  for (int col = 0; col < input_data.cols(); col++)
+  {
+    Eigen::VectorXf sample = input_data.col(col);
+    Eigen::VectorXf y(output.inputSize());
+    input << sample;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    output >> y;
+    result.col(col) = y;
+  }
+  return result;
+}
+
+/***********************************************************/
+// Expanding then contracting affine layers (with an identity
+// activation between them) are folded into one layer
+//
+// Tests:
+//    - network::fold
+//    - network::InferencePlan::Parameters::fold
+//    - layer::FullyConnected::setParameters
+/***********************************************************/
+TEST(TestNetworkFold, Expanding)
+{
+  static const int SAMPLES = 8;
+
+  auto input = boost::make_shared<Input>(12);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input,
+                                  boost::make_shared<Hidden>(32),
+                                  boost::make_shared<Identity>(),
+                                  boost::make_shared<Hidden>(4),
+                                  boost::make_shared<Sigmoid>(),
+                                  output});
+  createChain(layers);
+
+  // Identity and both affine layers are folded into one
+  Graph graph;
+  ASSERT_TRUE(graph.build(layers));
+  EXPECT_EQ(ffnn::network::fold(graph), 2UL);
+  ASSERT_EQ(graph.nodes.size(), 4UL);
+  EXPECT_EQ(graph.nodes[0].layer, layers[0]);
+  EXPECT_EQ(graph.nodes[1].layer->inputSize(), 12);
+  EXPECT_EQ(graph.nodes[1].layer->outputSize(), 4);
+  EXPECT_EQ(graph.nodes[2].layer, layers[4]);
+  EXPECT_EQ(graph.nodes[2].prev, std::vector<std::size_t>({1UL}));
+  EXPECT_EQ(graph.nodes[3].prev, std::vector<std::size_t>({2UL}));
+
+  // Original layers are untouched
+  EXPECT_EQ(layers[3]->getPreviousLayers().begin()->second, layers[2]);
+
+  const Eigen::MatrixXf input_data = Eigen::MatrixXf::Random(12, SAMPLES);
+  const Eigen::MatrixXf expected = forward(layers, *input, *output, input_data);
+
+  Plan plan(Plan::Parameters(true));
+  ASSERT_TRUE(plan.compile(layers));
+  EXPECT_EQ(plan.getLayers().size(), 4UL);
+
+  Plan::Workspace workspace = plan.createWorkspace(SAMPLES);
+  Eigen::MatrixXf result(4, SAMPLES);
+  EXPECT_TRUE(plan.forward(input_data, result, workspace));
+  EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+
+  // Folding is disabled by default
+  Plan unfolded;
+  ASSERT_TRUE(unfolded.compile(layers));
+  EXPECT_EQ(unfolded.getLayers().size(), layers.size());
+}
+
+/***********************************************************/
+// Contracting then expanding affine layers are not folded,
+// since the product would take more multiply-adds
+//
+// Tests:
+//    - network::fold
+/***********************************************************/
+TEST(TestNetworkFold, Bottleneck)
+{
+  static const int SAMPLES = 8;
+
+  auto input = boost::make_shared<Input>(32);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input,
+                                  boost::make_shared<Hidden>(4),
+                                  boost::make_shared<Identity>(),
+                                  boost::make_shared<Hidden>(32),
+                                  output});
+  createChain(layers);
+
+  // Only the identity is dropped
+  Graph graph;
+  ASSERT_TRUE(graph.build(layers));
+  EXPECT_EQ(ffnn::network::fold(graph), 1UL);
+  ASSERT_EQ(graph.nodes.size(), 4UL);
+  EXPECT_EQ(graph.nodes[1].layer, layers[1]);
+  EXPECT_EQ(graph.nodes[2].layer, layers[3]);
+  EXPECT_EQ(graph.nodes[2].prev, std::vector<std::size_t>({1UL}));
+
+  const Eigen::MatrixXf input_data = Eigen::MatrixXf::Random(32, SAMPLES);
+  const Eigen::MatrixXf expected = forward(layers, *input, *output, input_data);
+
+  Plan plan(Plan::Parameters(true));
+  ASSERT_TRUE(plan.compile(layers));
+  EXPECT_EQ(plan.getLayers().size(), 4UL);
+
+  Plan::Workspace workspace = plan.createWorkspace(SAMPLES);
+  Eigen::MatrixXf result(32, SAMPLES);
+  EXPECT_TRUE(plan.forward(input_data, result, workspace));
+  EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+}
+
+/***********************************************************/
+// Affine layers which also feed other layers are not folded
+//
+// Tests:
+//    - network::fold
+/***********************************************************/
+TEST(TestNetworkFold, FanOut)
+{
+  auto input = boost::make_shared<Input>(12);
+  auto hidden1 = boost::make_shared<Hidden>(32);
+  auto hidden2 = boost::make_shared<Hidden>(4);
+  auto output1 = boost::make_shared<Output>();
+  auto output2 = boost::make_shared<Output>();
+
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input, hidden1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden1, hidden2));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden2, output1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden1, output2));
+
+  std::vector<Layer::Ptr> layers({input, hidden1, hidden2, output1, output2});
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Graph graph;
+  ASSERT_TRUE(graph.build(layers));
+  EXPECT_EQ(ffnn::network::fold(graph), 0UL);
+  EXPECT_EQ(graph.nodes.size(), layers.size());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <cstdlib>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/layer/sparsely_connected.h>
+#include <ffnn/network/hogwild.h>
+#include <ffnn/optimizer/gradient_descent.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Sparse = ffnn::layer::SparselyConnected<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Output = ffnn::layer::Output<float>;
+using Trainer = ffnn::network::Hogwild<float>;
+
+/***********************************************************/
+// Trains a network with sparse, high-dimensional inputs on
+// several threads and checks that error decreases
+//
+// Tests:
+//    - network::Hogwild
+//    - layer::SparselyConnected::shareParameters
+//    - layer::FullyConnected::shareParameters
+//    - optimizer::GradientDescent (SparselyConnected)
+/***********************************************************/
+TEST(TestNetworkHogwild, SparseInputs)
+{
+  static const int INPUTS = 512;
+  static const int OUTPUTS = 4;
+  static const int SAMPLES = 400;
+  static const int REPLICAS = 4;
+
+  // Sparse inputs (few active features) and targets from a linear teacher
+  Eigen::MatrixXf inputs = Eigen::MatrixXf::Zero(INPUTS, SAMPLES);
+  for (int sdx = 0; sdx < SAMPLES; sdx++)
+  {
+    for (int kdx = 0; kdx < 8; kdx++)
+    {
+      inputs(std::rand() % INPUTS, sdx) = 1.0f;
+    }
+  }
+  const Eigen::MatrixXf teacher = 0.1f * Eigen::MatrixXf::Random(OUTPUTS, INPUTS);
+  const Eigen::MatrixXf targets = teacher * inputs;
+
+  // Create replicas
+  std::vector<Trainer::LayerSequence> replicas;
+  for (int rdx = 0; rdx < REPLICAS; rdx++)
+  {
+    auto sparse = boost::make_shared<Sparse>(32, Sparse::Parameters(0.5, 0.1, 0.1));
+    auto hidden = boost::make_shared<Hidden>(OUTPUTS, Hidden::Parameters(0.1, 0.1));
+    sparse->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Sparse>>(5e-2));
+    hidden->setOptimizer(boost::make_shared<ffnn::optimizer::GradientDescent<Hidden>>(5e-2));
+
+    Trainer::LayerSequence layers({boost::make_shared<Input>(INPUTS),
+                                   sparse,
+                                   hidden,
+                                   boost::make_shared<Output>()});
+    for (size_t idx = 1UL; idx < layers.size(); idx++)
+    {
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+    }
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->initialize());
+    }
+    replicas.push_back(layers);
+  }
+
+  Trainer trainer(Trainer::Parameters(4));
+  ASSERT_TRUE(trainer.setup(replicas));
+  EXPECT_EQ(trainer.replicaCount(), static_cast<size_t>(REPLICAS));
+
+  const Trainer::SampleLoader load_inputs = [&inputs](const Trainer::LayerSequence& layers, Trainer::SizeType sdx)
+  {
+    (*boost::static_pointer_cast<Input>(layers.front())) << inputs.col(sdx);
+    return true;
+  };
+  const Trainer::SampleLoader load_targets = [&targets](const Trainer::LayerSequence& layers, Trainer::SizeType sdx)
+  {
+    (*boost::static_pointer_cast<Output>(layers.back())) << targets.col(sdx);
+    return true;
+  };
+
+  // Mean error over all samples with the current (shared) parameters
+  const auto error = [&]()
+  {
+    float total = 0;
+    Eigen::VectorXf result(OUTPUTS);
+    for (int sdx = 0; sdx < SAMPLES; sdx++)
+    {
+      load_inputs(replicas[0], sdx);
+      for(const auto& layer : replicas[0])
+      {
+        layer->forward();
+      }
+      (*boost::static_pointer_cast<Output>(replicas[0].back())) >> result;
+      total += (result - targets.col(sdx)).norm();
+    }
+    return total / SAMPLES;
+  };
+
+  const float initial_error = error();
+  for (int epoch = 0; epoch < 20; epoch++)
+  {
+    EXPECT_TRUE(trainer.run(SAMPLES, load_inputs, load_targets));
+  }
+  EXPECT_LT(error(), 0.5f * initial_error);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
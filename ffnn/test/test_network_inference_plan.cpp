@@ -0,0 +1,326 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/fully_connected_activation.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+#include <ffnn/thread/work_stealing_pool.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Fused = ffnn::layer::FullyConnectedActivation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Plan = ffnn::network::InferencePlan<float>;
+
+/***********************************************************/
+// Compiles a chain network and checks single-sample,
+// batched and concurrent passes against the layer graph
+//
+// Tests:
+//    - network::InferencePlan
+//    - layer::FullyConnected::infer
+//    - layer::FullyConnectedActivation::infer
+//    - layer::Activation::infer
+/***********************************************************/
+TEST(TestNetworkInferencePlan, Chain)
+{
+  static const int SAMPLES = 16;
+
+  // Create layers
+  auto input = boost::make_shared<Input>(12);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input,
+                                  boost::make_shared<Hidden>(32),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Fused>(8),
+                                  boost::make_shared<Hidden>(3),
+                                  output});
+
+  // Connect and initialize layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Reference outputs from the layer graph
+  const Eigen::MatrixXf input_data = Eigen::MatrixXf::Random(12, SAMPLES);
+  Eigen::MatrixXf expected(3, SAMPLES);
+  for (int col = 0; col < SAMPLES; col++)
+  {
+    Eigen::VectorXf sample = input_data.col(col);
+    Eigen::VectorXf result(3);
+    (*input) << sample;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> result;
+    expected.col(col) = result;
+  }
+
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  EXPECT_EQ(plan.inputCount(), 1UL);
+  EXPECT_EQ(plan.outputCount(), 1UL);
+
+  // Single sample
+  {
+    Plan::Workspace workspace = plan.createWorkspace();
+    Eigen::VectorXf sample = input_data.col(0);
+    Eigen::VectorXf result(3);
+    EXPECT_TRUE(plan.forward(sample, result, workspace));
+    EXPECT_TRUE(result.isApprox(expected.col(0), 1e-5f));
+  }
+
+  // Batch
+  {
+    Plan::Workspace workspace = plan.createWorkspace(SAMPLES);
+    Eigen::MatrixXf result(3, SAMPLES);
+    EXPECT_TRUE(plan.forward(input_data, result, workspace));
+    EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+  }
+
+  // Concurrent passes with per-thread workspaces
+  std::vector<Eigen::MatrixXf> results(4, Eigen::MatrixXf(3, SAMPLES));
+  std::vector<std::thread> threads;
+  for (size_t tdx = 0; tdx < results.size(); tdx++)
+  {
+    threads.emplace_back([&plan, &input_data, &results, tdx]()
+    {
+      Plan::Workspace workspace = plan.createWorkspace();
+      for (int itr = 0; itr < 50; itr++)
+      {
+        for (int col = 0; col < SAMPLES; col++)
+        {
+          Eigen::VectorXf sample = input_data.col(col);
+          Eigen::VectorXf result(3);
+          plan.forward(sample, result, workspace);
+          results[tdx].col(col) = result;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  for (const auto& result : results)
+  {
+    EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+  }
+}
+
+/***********************************************************/
+// Compiles a network with a multi-input (concatenating)
+// layer and checks it against the layer graph
+//
+// Tests:
+//    - network::InferencePlan
+/***********************************************************/
+TEST(TestNetworkInferencePlan, Concatenation)
+{
+  // Create layers
+  auto input1 = boost::make_shared<Input>(7);
+  auto input2 = boost::make_shared<Input>(5);
+  auto hidden1 = boost::make_shared<Hidden>(9);
+  auto hidden2 = boost::make_shared<Hidden>(4);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input1, input2, hidden1, hidden2, output});
+
+  // hidden2 concatenates the outputs of hidden1 and input2
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input1, hidden1));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden1, hidden2));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input2, hidden2));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden2, output));
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Eigen::VectorXf input1_data = Eigen::VectorXf::Random(7);
+  Eigen::VectorXf input2_data = Eigen::VectorXf::Random(5);
+  Eigen::VectorXf expected(4);
+  (*input1) << input1_data;
+  (*input2) << input2_data;
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->forward());
+  }
+  (*output) >> expected;
+
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  ASSERT_EQ(plan.inputCount(), 2UL);
+  EXPECT_EQ(plan.inputSize(0), 7);
+  EXPECT_EQ(plan.inputSize(1), 5);
+
+  Plan::Workspace workspace = plan.createWorkspace();
+  Eigen::VectorXf result(4);
+  const float* inputs[2] = {input1_data.data(), input2_data.data()};
+  float* outputs[1] = {result.data()};
+  EXPECT_TRUE(plan.forward(inputs, outputs, 1, workspace));
+  EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+}
+
+/***********************************************************/
+// Compiles a multi-tower network and checks passes which
+// evaluate towers concurrently against the layer graph
+//
+// Tests:
+//    - network::InferencePlan (parallel forward)
+//    - thread::WorkStealingPool
+/***********************************************************/
+TEST(TestNetworkInferencePlan, ParallelBranches)
+{
+  static const int TOWERS = 4;
+  static const int SAMPLES = 8;
+
+  // Each tower has its own input; a final layer concatenates all towers
+  std::vector<Layer::Ptr> layers;
+  std::vector<boost::shared_ptr<Input>> inputs;
+  std::vector<Layer::Ptr> towers;
+  for (int tdx = 0; tdx < TOWERS; tdx++)
+  {
+    inputs.push_back(boost::make_shared<Input>(6 + tdx));
+    layers.push_back(inputs.back());
+  }
+  for (int tdx = 0; tdx < TOWERS; tdx++)
+  {
+    std::vector<Layer::Ptr> tower({boost::make_shared<Hidden>(24),
+                                   boost::make_shared<Activation>(),
+                                   boost::make_shared<Fused>(5 + tdx)});
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(inputs[tdx], tower.front()));
+    for (size_t idx = 1UL; idx < tower.size(); idx++)
+    {
+      EXPECT_TRUE(ffnn::layer::connect<Layer>(tower[idx-1UL], tower[idx]));
+    }
+    layers.insert(layers.end(), tower.begin(), tower.end());
+    towers.push_back(tower.back());
+  }
+  auto merge = boost::make_shared<Hidden>(3);
+  auto output = boost::make_shared<Output>();
+  for (const auto& tower : towers)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(tower, merge));
+  }
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(merge, output));
+  layers.push_back(merge);
+  layers.push_back(output);
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Reference outputs from the layer graph
+  std::vector<Eigen::MatrixXf> input_data;
+  for (int tdx = 0; tdx < TOWERS; tdx++)
+  {
+    input_data.push_back(Eigen::MatrixXf::Random(6 + tdx, SAMPLES));
+  }
+  Eigen::MatrixXf expected(3, SAMPLES);
+  for (int col = 0; col < SAMPLES; col++)
+  {
+    for (int tdx = 0; tdx < TOWERS; tdx++)
+    {
+      Eigen::VectorXf sample = input_data[tdx].col(col);
+      (*inputs[tdx]) << sample;
+    }
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    Eigen::VectorXf result(3);
+    (*output) >> result;
+    expected.col(col) = result;
+  }
+
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  ASSERT_EQ(plan.inputCount(), static_cast<size_t>(TOWERS));
+
+  ffnn::thread::WorkStealingPool pool(3);
+  std::vector<const float*> input_ptrs;
+  for (const auto& data : input_data)
+  {
+    input_ptrs.push_back(data.data());
+  }
+
+  // Batch
+  {
+    Plan::Workspace workspace = plan.createWorkspace(SAMPLES);
+    Eigen::MatrixXf result(3, SAMPLES);
+    float* outputs[1] = {result.data()};
+    EXPECT_TRUE(plan.forward(input_ptrs.data(), outputs, SAMPLES, workspace, pool));
+    EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+  }
+
+  // Repeated passes from concurrent clients sharing one pool
+  std::vector<Eigen::MatrixXf> results(2, Eigen::MatrixXf(3, SAMPLES));
+  std::vector<std::thread> threads;
+  for (size_t tdx = 0; tdx < results.size(); tdx++)
+  {
+    threads.emplace_back([&plan, &pool, &input_data, &results, tdx]()
+    {
+      Plan::Workspace workspace = plan.createWorkspace();
+      for (int itr = 0; itr < 100; itr++)
+      {
+        for (int col = 0; col < SAMPLES; col++)
+        {
+          std::vector<Eigen::VectorXf> samples;
+          std::vector<const float*> sample_ptrs;
+          for (const auto& data : input_data)
+          {
+            samples.push_back(data.col(col));
+          }
+          for (const auto& sample : samples)
+          {
+            sample_ptrs.push_back(sample.data());
+          }
+          Eigen::VectorXf result(3);
+          float* outputs[1] = {result.data()};
+          EXPECT_TRUE(plan.forward(sample_ptrs.data(), outputs, 1, workspace, pool));
+          results[tdx].col(col) = result;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  for (const auto& result : results)
+  {
+    EXPECT_TRUE(result.isApprox(expected, 1e-5f));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,227 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <thread>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/embedding.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/fully_connected_activation.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/inference_plan.h>
+#include <ffnn/network/pipeline.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+
+// Layer-type alias
+using Layer  = ffnn::layer::Layer<float>;
+using Input  = ffnn::layer::Input<float>;
+using Hidden = ffnn::layer::FullyConnected<float>;
+using Activation = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid>;
+using Embedding = ffnn::layer::Embedding<float>;
+using Fused = ffnn::layer::FullyConnectedActivation<float, ffnn::neuron::LeCunSigmoid>;
+using Output = ffnn::layer::Output<float>;
+using Plan = ffnn::network::InferencePlan<float>;
+using Pipeline = ffnn::network::Pipeline<float>;
+
+/***********************************************************/
+// Streams micro-batches of varying size through a three
+// stage pipeline and checks outputs and their order
+//
+// Tests:
+//    - network::Pipeline
+//    - internal::SpscQueue
+/***********************************************************/
+TEST(TestNetworkPipeline, Streaming)
+{
+  static const int BATCHES = 200;
+  static const int MAX_BATCH = 4;
+
+  // Create layers
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(12),
+                                  boost::make_shared<Hidden>(32),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Fused>(16),
+                                  boost::make_shared<Hidden>(8),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(3),
+                                  boost::make_shared<Output>()});
+
+  // Connect and initialize layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Pipeline pipeline(Pipeline::Parameters(3, MAX_BATCH));
+  ASSERT_TRUE(pipeline.compile(layers));
+  ASSERT_EQ(pipeline.stageCount(), 3UL);
+  EXPECT_EQ(pipeline.stageSize(0) + pipeline.stageSize(1) + pipeline.stageSize(2), layers.size() - 2);
+  EXPECT_EQ(pipeline.inputSize(), 12);
+  EXPECT_EQ(pipeline.outputSize(), 3);
+
+  // Reference outputs
+  Plan plan;
+  ASSERT_TRUE(plan.compile(layers));
+  Plan::Workspace workspace = plan.createWorkspace(MAX_BATCH);
+  std::vector<Eigen::MatrixXf> inputs, expected;
+  for (int bdx = 0; bdx < BATCHES; bdx++)
+  {
+    const int count = 1 + (bdx % MAX_BATCH);
+    inputs.push_back(Eigen::MatrixXf::Random(12, count));
+    expected.push_back(Eigen::MatrixXf(3, count));
+    EXPECT_TRUE(plan.forward(inputs.back(), expected.back(), workspace));
+  }
+
+  // Produce and consume on separate threads
+  std::thread producer([&pipeline, &inputs]()
+  {
+    for (const auto& input : inputs)
+    {
+      pipeline.push(input.data(), input.cols());
+    }
+  });
+
+  Eigen::MatrixXf output(3, MAX_BATCH);
+  for (int bdx = 0; bdx < BATCHES; bdx++)
+  {
+    const Pipeline::SizeType count = pipeline.pop(output.data());
+    ASSERT_EQ(count, expected[bdx].cols());
+    EXPECT_TRUE(output.leftCols(count).isApprox(expected[bdx], 1e-5f));
+  }
+  producer.join();
+
+  // Nothing left in flight
+  Pipeline::SizeType count;
+  EXPECT_FALSE(pipeline.tryPop(output.data(), count));
+}
+
+/***********************************************************/
+// Checks that stages are split by per-sample layer cost, so
+// cheap element-wise layers share a stage with each other
+//
+// Tests:
+//    - network::Pipeline::compile
+//    - layer::Layer::costPerSample
+/***********************************************************/
+TEST(TestNetworkPipeline, BalancesCost)
+{
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(256),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Activation>(),
+                                  boost::make_shared<Hidden>(64),
+                                  boost::make_shared<Output>()});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+  EXPECT_EQ(layers[1]->costPerSample(), 256.0 + 256.0);
+  EXPECT_EQ(layers[4]->costPerSample(), 257.0 * 64.0);
+
+  // All activations are cheaper than the fully-connected layer together
+  Pipeline pipeline(Pipeline::Parameters(2, 4));
+  ASSERT_TRUE(pipeline.compile(layers));
+  ASSERT_EQ(pipeline.stageCount(), 2UL);
+  EXPECT_EQ(pipeline.stageSize(0), 3UL);
+  EXPECT_EQ(pipeline.stageSize(1), 1UL);
+}
+
+/***********************************************************/
+// Checks that non-chain networks are rejected
+//
+// Tests:
+//    - network::Pipeline
+/***********************************************************/
+TEST(TestNetworkPipeline, RejectsNonChain)
+{
+  auto input1 = boost::make_shared<Input>(7);
+  auto input2 = boost::make_shared<Input>(5);
+  auto hidden = boost::make_shared<Hidden>(4);
+  auto output = boost::make_shared<Output>();
+  std::vector<Layer::Ptr> layers({input1, input2, hidden, output});
+
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input1, hidden));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(input2, hidden));
+  EXPECT_TRUE(ffnn::layer::connect<Layer>(hidden, output));
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Pipeline pipeline;
+  EXPECT_FALSE(pipeline.compile(layers));
+}
+
+/***********************************************************/
+// Micro-batches which a layer fails to evaluate are returned
+// in order, as empty micro-batches
+//
+// Tests:
+//    - network::Pipeline (evaluation failures)
+/***********************************************************/
+TEST(TestNetworkPipeline, ReportsFailures)
+{
+  static const int VOCABULARY = 10;
+
+  // Embedding lookups fail for invalid ids
+  std::vector<Layer::Ptr> layers({boost::make_shared<Input>(1),
+                                  boost::make_shared<Embedding>(VOCABULARY, 4),
+                                  boost::make_shared<Hidden>(2),
+                                  boost::make_shared<Output>()});
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  Pipeline pipeline(Pipeline::Parameters(2, 1));
+  ASSERT_TRUE(pipeline.compile(layers));
+  ASSERT_EQ(pipeline.stageCount(), 2UL);
+
+  // Feed valid and invalid ids from another thread
+  const std::vector<float> ids({3, VOCABULARY, 5, -1, 7});
+  std::thread producer([&]()
+  {
+    for (const float& id : ids)
+    {
+      pipeline.push(&id, 1);
+    }
+  });
+
+  for (const float id : ids)
+  {
+    float y[2];
+    EXPECT_EQ(pipeline.pop(y), (id >= 0 && id < VOCABULARY) ? 1 : 0);
+  }
+  producer.join();
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
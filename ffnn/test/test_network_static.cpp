@@ -0,0 +1,103 @@
+/**
+ * @author Brian Cairl
+ * @date 2017
+ */
+// C++ Standard Library
+#include <type_traits>
+#include <vector>
+
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// FFNN
+#include <ffnn/layer/activation.h>
+#include <ffnn/layer/fully_connected.h>
+#include <ffnn/layer/fully_connected_activation.h>
+#include <ffnn/layer/input.h>
+#include <ffnn/layer/layer.h>
+#include <ffnn/layer/output.h>
+#include <ffnn/network/static_network.h>
+#include <ffnn/neuron/lecun_sigmoid.h>
+
+/***********************************************************/
+// Builds a fixed-size network with the regular layer graph,
+// copies it into a StaticNetwork, and checks that both
+// produce the same outputs
+//
+// Tests:
+//    - network::StaticNetwork
+//    - network::StaticStage
+/***********************************************************/
+TEST(TestNetworkStatic, MatchesLayerGraph)
+{
+  // Layer-type alias
+  using Layer  = ffnn::layer::Layer<float>;
+  using Input  = ffnn::layer::Input<float>;
+  using Hidden1 = ffnn::layer::FullyConnected<float, 4, 8>;
+  using Hidden2 = ffnn::layer::Activation<float, ffnn::neuron::LeCunSigmoid, 8>;
+  using Hidden3 = ffnn::layer::FullyConnectedActivation<float, ffnn::neuron::LeCunSigmoid, 8, 3>;
+  using Output = ffnn::layer::Output<float>;
+  using Network = ffnn::network::StaticNetwork<float, Hidden1, Hidden2, Hidden3>;
+
+  static_assert(Network::InputVector::RowsAtCompileTime == 4, "Unexpected network input size.");
+  static_assert(Network::OutputVector::RowsAtCompileTime == 3, "Unexpected network output size.");
+  static_assert(std::is_same<Network::ScalarType, float>::value, "Unexpected network scalar type.");
+  static_assert(!ffnn::network::internal::ScalarsMatch<double, ffnn::network::StaticStage<Hidden1>>::value,
+                "Stage scalar type mismatch is not detected.");
+
+  // Create layers
+  auto input = boost::make_shared<Input>(4);
+  // NOTE: fixed-size layers hold fixed-size Eigen members, so they are
+  //       created with their aligned operator new rather than make_shared
+  boost::shared_ptr<Hidden1> hidden1(new Hidden1());
+  boost::shared_ptr<Hidden2> hidden2(new Hidden2());
+  boost::shared_ptr<Hidden3> hidden3(new Hidden3());
+  auto output = boost::make_shared<Output>();
+
+  // Create network
+  std::vector<Layer::Ptr> layers({input, hidden1, hidden2, hidden3, output});
+
+  // Connect and initialize layers
+  for (size_t idx = 1UL; idx < layers.size(); idx++)
+  {
+    EXPECT_TRUE(ffnn::layer::connect<Layer>(layers[idx-1UL], layers[idx]));
+  }
+  for(const auto& layer : layers)
+  {
+    EXPECT_TRUE(layer->initialize());
+  }
+
+  // Create static network from (randomly initialized) layers
+  Network network;
+  network.copy(*hidden1, *hidden2, *hidden3);
+  EXPECT_TRUE(network.stage<0>().w.isApprox(hidden1->getWeights()));
+
+  for (size_t idx = 0UL; idx < 10; idx++)
+  {
+    Network::InputVector input_data = Network::InputVector::Random();
+    Eigen::VectorXf input_vector(input_data);
+    Eigen::VectorXf output_data(3);
+
+    // Forward activate layer graph
+    (*input) << input_vector;
+    for(const auto& layer : layers)
+    {
+      EXPECT_TRUE(layer->forward());
+    }
+    (*output) >> output_data;
+
+    // Forward activate static network
+    const Network::OutputVector& static_output = network.forward(input_data);
+    EXPECT_TRUE(static_output.isApprox(output_data, 1e-5f));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}